@@ -205,7 +205,22 @@ inline const Aabb Aabb::half = Aabb(float3(-0.25f), float3(0.25f));
  * @param[in] a first AABB to binary compare
  * @param[in] b secong AABB to binary compare
  */
-static bool isBinaryLess(const Aabb& a, const Aabb& b) noexcept { return memcmp(&a, &b, sizeof(float3) * 2) < 0; }
+static bool isBinaryLess(const Aabb& a, const Aabb& b) noexcept { return std::memcmp(&a, &b, sizeof(float3) * 2) < 0; }
+
+/***********************************************************************************************************************
+ * @brief AABB array in the structure of arrays layout. (SoA)
+ * @details Used by the batched broadphase tests to utilize full SIMD width.
+ */
+struct AabbSoA
+{
+	const float* minX; /**< Minimum corner X component array. */
+	const float* minY; /**< Minimum corner Y component array. */
+	const float* minZ; /**< Minimum corner Z component array. */
+	const float* maxX; /**< Maximum corner X component array. */
+	const float* maxY; /**< Maximum corner Y component array. */
+	const float* maxZ; /**< Maximum corner Z component array. */
+	psize count;       /**< Total AABB count in the arrays. */
+};
 
 /***********************************************************************************************************************
  * @brief Returns true if point is inside the AABB.
@@ -100,10 +100,10 @@ struct Bvh
 		void setAabb(const Aabb& aabb) noexcept { base.min = aabb.getMin(), base.max = aabb.getMax(); }
 	};
 protected:
-	vector<Node> nodes;
-	vector<uint32> primitives;
-	vector<float3> centroids;
-	stack<Node*> nodeStack;
+	std::vector<Node> nodes;
+	std::vector<uint32> primitives;
+	std::vector<float3> centroids;
+	std::stack<Node*> nodeStack;
 public:
 	/*******************************************************************************************************************
 	 * @brief Creates a new BVH from the triangle array.
@@ -135,15 +135,15 @@ public:
 	/**
 	 * @brief Returns BVH node array.
 	 */
-	const vector<Node>& getNodes() const noexcept { return nodes; }
+	const std::vector<Node>& getNodes() const noexcept { return nodes; }
 	/**
 	 * @brief Returns BVH primitive array.
 	 */
-	const vector<uint32>& getPrimitives() const noexcept { return primitives; }
+	const std::vector<uint32>& getPrimitives() const noexcept { return primitives; }
 	/**
 	 * @brief Returns BVH centroid array.
 	 */
-	const vector<float3>& getCentroids() const noexcept { return centroids; }
+	const std::vector<float3>& getCentroids() const noexcept { return centroids; }
 
 	/**
 	 * @brief Recreates BVH from the triangle array.
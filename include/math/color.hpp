@@ -58,15 +58,15 @@ struct Color
 	 * @brief Creates a new sRGB color structure from the hexadecimal string.
 	 * @param[in] hex target hexadecimal color string
 	 */
-	explicit Color(const string& hex)
+	explicit Color(const std::string& hex)
 	{
 		assert(hex.length() == 8 || hex.length() == 6);
-		r = toInt32(string(hex.c_str(), 2));
-		g = toInt32(string(hex.c_str() + 2, 2));
-		b = toInt32(string(hex.c_str() + 4, 2));
+		r = toInt32(std::string(hex.c_str(), 2));
+		g = toInt32(std::string(hex.c_str() + 2, 2));
+		b = toInt32(std::string(hex.c_str() + 4, 2));
 
 		if (hex.length() == 8)
-			a = toInt32(string(hex.c_str() + 6, 2));
+			a = toInt32(std::string(hex.c_str() + 6, 2));
 	}
 	
 	/**
@@ -177,27 +177,27 @@ struct Color
 	/*******************************************************************************************************************
 	 * @brief Converts sRGB color to the string. (Space separated)
 	 */
-	string toString4() const noexcept
+	std::string toString4() const noexcept
 	{
-		return to_string(r) + " " + to_string(g) + " " + to_string(b) + " " + to_string(a);
+		return std::to_string(r) + " " + std::to_string(g) + " " + std::to_string(b) + " " + std::to_string(a);
 	}
 	/***
 	 * @brief Converts sRGB color to the string. (Space separated)
 	 */
-	string toString3() const noexcept { return to_string(r) + " " + to_string(g) + " " + to_string(b); }
+	std::string toString3() const noexcept { return std::to_string(r) + " " + std::to_string(g) + " " + std::to_string(b); }
 	/***
 	 * @brief Converts sRGB color to the string. (Space separated)
 	 */
-	string toString2() const noexcept { return to_string(r) + " " + to_string(g); }
+	std::string toString2() const noexcept { return std::to_string(r) + " " + std::to_string(g); }
 	/***
 	 * @brief Converts sRGB color to the string. (Space separated)
 	 */
-	string toString1() const noexcept { return to_string(r); }
+	std::string toString1() const noexcept { return std::to_string(r); }
 
 	/**
 	 * @brief Converts sRGB color to the RGB hexadecimal string.
 	 */
-	string toHex4() const noexcept
+	std::string toHex4() const noexcept
 	{
 		auto hex = math::toHex(r);
 		hex += math::toHex(g);
@@ -208,7 +208,7 @@ struct Color
 	/**
 	 * @brief Converts sRGB color to the RGBA hexadecimal string.
 	 */
-	string toHex3() const noexcept
+	std::string toHex3() const noexcept
 	{
 		auto hex = math::toHex(r);
 		hex += math::toHex(g);
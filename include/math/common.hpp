@@ -18,6 +18,7 @@
  */
 
 #pragma once
+#include "math/simd.hpp"
 #include "math/types.hpp"
 
 #if _WIN32
@@ -28,11 +29,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cassert>
+#include <cstring>
 
 namespace math
 {
 
-using namespace std;
 
 static constexpr float min(float a, float b, float c) { return std::min(std::min(a, b), c); }
 static constexpr float max(float a, float b, float c) { return std::max(std::max(a, b), c); }
@@ -41,19 +42,13 @@ static constexpr int32 max(int32 a, int32 b, int32 c) { return std::max(std::max
 
 static float repeat(float v) noexcept
 {
-	if (v < 0.0f)
-		return 1.0f - std::fmod(-v, 1.0f);
-	if (v >= 1.0f)
-		return std::fmod(v, 1.0f);
-	return v;
+	return v - std::floor(v);
 }
-static float sign(float v) noexcept
+static constexpr float sign(float v) noexcept
 {
-	if (v == 0.0f)
-		return 0.0f;
-	return std::signbit(v) ? -1.0f : 1.0f;
+	return (float)((v > 0.0f) - (v < 0.0f));
 }
-static float lerp(float a, float b, float t) noexcept
+static constexpr float lerp(float a, float b, float t) noexcept
 {
 	assert(t >= 0.0f);
 	assert(t <= 1.0f);
@@ -65,8 +60,143 @@ static float lerpDelta(float a, float b, float f, float dt) noexcept
 }
 static float gain(float x, float k) noexcept
 {
-	auto a = 0.5f * std::pow(2.0f * ((x < 0.5f) ? x : 1.0f - x), k);
+	auto a = 0.5f * std::pow(2.0f * std::min(x, 1.0f - x), k);
 	return (x < 0.5f) ? a : 1.0f - a;
 }
 
+/**
+ * @brief Calculates sine and cosine of the value at once.
+ * @details Shares the argument range reduction between both results, cheaper than separate calls.
+ *
+ * @param v target value to calculate sine and cosine (in radians)
+ * @param[out] s resulting sine value
+ * @param[out] c resulting cosine value
+ */
+static void sinCos(float v, float& s, float& c) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_sincosf(v, &s, &c);
+#else
+	s = std::sin(v); c = std::cos(v);
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Calculates approximate base 2 logarithm of the value. (Fast approximation)
+ * @details Exponent bits plus a polynomial of the mantissa, relative error is around 1.0e-5.
+ * @param v target value to calculate logarithm (positive)
+ */
+static float fastLog2(float v) noexcept
+{
+	uint32 bits; std::memcpy(&bits, &v, sizeof(float));
+	auto e = (float)((int32)(bits >> 23) - 127);
+	bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+	float m; std::memcpy(&m, &bits, sizeof(float));
+	auto p = -0.056570851f;
+	p = p * m + 0.44717955f;
+	p = p * m - 1.4699568f;
+	p = p * m + 2.8212026f;
+	p = p * m - 1.7417939f;
+	return p * 1.4426950f + e;
+}
+/**
+ * @brief Calculates approximate 2 raised to the value power. (Fast approximation)
+ * @details Polynomial of the fraction scaled by the exponent bits, relative error is around 1.0e-4.
+ * @param v target value to raise 2 to
+ */
+static float fastExp2(float v) noexcept
+{
+	v = std::max(v, -127.0f);
+	auto f = std::floor(v);
+	auto x = v - f;
+	auto p = 0.0013333558f;
+	p = p * x + 0.0096181291f;
+	p = p * x + 0.055504109f;
+	p = p * x + 0.24022651f;
+	p = p * x + 0.69314718f;
+	p = p * x + 1.0f;
+	uint32 bits = (uint32)((int32)f + 127) << 23;
+	float s; std::memcpy(&s, &bits, sizeof(float));
+	return s * p;
+}
+/**
+ * @brief Calculates approximate value raised to the power. (Fast approximation)
+ * @details Evaluated as exp2(b * log2(a)), use it where libm precision is not required.
+ *
+ * @param a target value to raise (positive)
+ * @param b target power to raise value to
+ */
+static float fastPow(float a, float b) noexcept { return fastExp2(b * fastLog2(a)); }
+/**
+ * @brief Calculates approximate reciprocal of the value. (Fast approximation)
+ * @details Hardware reciprocal estimation with one Newton-Raphson step, relative error is around 1.0e-6.
+ * @param v target value to calculate reciprocal (non-zero)
+ */
+static float fastRcp(float v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto d = _mm_set_ss(v);
+	auto r = _mm_rcp_ss(d);
+	r = _mm_mul_ss(r, _mm_sub_ss(_mm_set_ss(2.0f), _mm_mul_ss(d, r)));
+	return _mm_cvtss_f32(r);
+#else
+	return 1.0f / v;
+#endif
+}
+/**
+ * @brief Calculates approximate reciprocal square root of the value. (Fast approximation)
+ * @details Hardware estimation with one Newton-Raphson step, relative error is around 1.0e-6.
+ * @param v target value to calculate reciprocal square root (positive)
+ */
+static float fastRsqrt(float v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto d = _mm_set_ss(v);
+	auto r = _mm_rsqrt_ss(d);
+	r = _mm_mul_ss(r, _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(
+		_mm_mul_ss(_mm_mul_ss(d, _mm_set_ss(0.5f)), r), r)));
+	return _mm_cvtss_f32(r);
+#else
+	return 1.0f / std::sqrt(v);
+#endif
+}
+/**
+ * @brief Calculates approximate remainder of the division. (Fast approximation)
+ * @details
+ * Evaluated as a - trunc(a / b) * b, which stays entirely on the floating point
+ * pipes instead of calling fmod, but loses precision when a / b is very large.
+ *
+ * @param a target value to divide
+ * @param b target divisor (non-zero)
+ */
+static float fastMod(float a, float b) noexcept
+{
+	return a - std::trunc(a / b) * b;
+}
+/**
+ * @brief Remaps the unit range with the gain curve. (Fast approximation)
+ * @details Same shape as @ref gain(), with the pow evaluated through @ref fastPow().
+ *
+ * @param x target value to remap (in 0.0 - 1.0 range)
+ * @param k target gain curve factor
+ */
+static float fastGain(float x, float k) noexcept
+{
+	auto a = 0.5f * fastPow(2.0f * std::min(x, 1.0f - x), k);
+	return (x < 0.5f) ? a : 1.0f - a;
+}
+/**
+ * @brief Linearly interpolates between two values using the delta time factor. (Fast approximation)
+ * @details Same curve as @ref lerpDelta(), with the pow evaluated through @ref fastPow().
+ *
+ * @param a starting value to interpolate from
+ * @param b target value to interpolate to
+ * @param f target interpolation factor (power base, positive)
+ * @param dt frame delta time value
+ */
+static float fastLerpDelta(float a, float b, float f, float dt) noexcept
+{
+	return a + (1.0f - fastPow(f, dt)) * (b - a);
+}
+
 } // namespace math
\ No newline at end of file
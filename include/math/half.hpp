@@ -0,0 +1,159 @@
+// Copyright 2022-2024 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Common half precision floating point functions. (IEEE 754 binary16)
+ */
+
+#pragma once
+#include "math/simd.hpp"
+
+#include <cstring>
+#include <cassert>
+
+namespace math
+{
+
+/**
+ * @brief Half precision floating point structure. (binary16)
+ * @details Commonly used to halve the memory traffic of the floating point data.
+ */
+struct half
+{
+	uint16 data; /**< Half floating point value bits. */
+
+	/**
+	 * @brief Creates a new zero half floating point structure.
+	 */
+	constexpr half() noexcept : data(0) { }
+	/**
+	 * @brief Creates a new half floating point structure. (Rounds to the nearest even)
+	 * @param v target single precision value to convert
+	 */
+	half(float v) noexcept
+	{
+	#if MATH_SIMD_F16C
+		data = (uint16)_mm_extract_epi16(_mm_cvtps_ph(
+			_mm_set_ss(v), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC), 0);
+	#elif defined(__ARM_FP16_FORMAT_IEEE)
+		auto h = (__fp16)v;
+		std::memcpy(&data, &h, sizeof(uint16));
+	#else
+		uint32 bits; std::memcpy(&bits, &v, sizeof(float));
+		auto sign = (uint16)((bits >> 16) & 0x8000u);
+		bits &= 0x7FFFFFFFu;
+		if (bits >= 0x47800000u)
+		{
+			// Overflows to infinity, NaN keeps a non-zero mantissa.
+			data = (uint16)(sign | 0x7C00u | (bits > 0x7F800000u ? 0x0200u : 0u));
+		}
+		else if (bits >= 0x38800000u)
+		{
+			// Normal number, round mantissa to the nearest even.
+			bits += 0xC8000000u + 0x00000FFFu + ((bits >> 13) & 1u);
+			data = (uint16)(sign | (bits >> 13));
+		}
+		else if (bits >= 0x33000000u)
+		{
+			// Subnormal number, shift in the implicit leading bit.
+			auto shift = 126u - (bits >> 23);
+			bits = (bits & 0x007FFFFFu) | 0x00800000u;
+			data = (uint16)(sign | ((bits + (1u << (shift - 1u)) +
+				((bits >> shift) & 1u) - 1u) >> shift));
+		}
+		else
+		{
+			data = sign; // Underflows to zero.
+		}
+	#endif
+	}
+
+	/**
+	 * @brief Converts half to the single precision floating point value.
+	 */
+	operator float() const noexcept
+	{
+	#if MATH_SIMD_F16C
+		return _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128((int32)data)));
+	#elif defined(__ARM_FP16_FORMAT_IEEE)
+		__fp16 h; std::memcpy(&h, &data, sizeof(uint16));
+		return (float)h;
+	#else
+		auto sign = ((uint32)data & 0x8000u) << 16;
+		auto abs = (uint32)data & 0x7FFFu;
+		uint32 bits;
+		if (abs >= 0x7C00u)
+			bits = sign | 0x7F800000u | (((uint32)data & 0x03FFu) << 13); // Infinity or NaN.
+		else if (abs >= 0x0400u)
+			bits = sign | ((abs + 0x1C000u) << 13); // Normal number.
+		else if (abs != 0u)
+		{
+			// Subnormal number, normalize the mantissa.
+			auto shift = 0u; auto mantissa = abs;
+			while ((mantissa & 0x0400u) == 0u) { mantissa <<= 1; shift++; }
+			bits = sign | ((113u - shift) << 23) | ((mantissa & 0x03FFu) << 13);
+		}
+		else
+		{
+			bits = sign; // Signed zero.
+		}
+		float v; std::memcpy(&v, &bits, sizeof(float));
+		return v;
+	#endif
+	}
+
+	constexpr bool operator==(half v) const noexcept { return data == v.data; }
+	constexpr bool operator!=(half v) const noexcept { return data != v.data; }
+};
+
+/**
+ * @brief Converts single precision floating point array to the half precision one.
+ *
+ * @param[in] floats target single precision value array
+ * @param[out] halfs resulting half precision value array
+ * @param count total value count in the arrays
+ */
+static void convertToHalf(const float* floats, half* halfs, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_F16C && MATH_SIMD_AVX2
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm_storeu_si128((__m128i*)(halfs + i), _mm256_cvtps_ph(
+			_mm256_loadu_ps(floats + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+	}
+#endif
+	for (; i < count; i++)
+		halfs[i] = half(floats[i]);
+}
+/**
+ * @brief Converts half precision floating point array to the single precision one.
+ *
+ * @param[in] halfs target half precision value array
+ * @param[out] floats resulting single precision value array
+ * @param count total value count in the arrays
+ */
+static void convertToFloat(const half* halfs, float* floats, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_F16C && MATH_SIMD_AVX2
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(floats + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(halfs + i))));
+#endif
+	for (; i < count; i++)
+		floats[i] = (float)halfs[i];
+}
+
+} // namespace math
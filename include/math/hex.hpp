@@ -19,7 +19,6 @@
 namespace math
 {
 
-using namespace std;
 
 /***********************************************************************************************************************
  * @brief Converts integer value to the hexadecimal string.
@@ -29,10 +28,10 @@ using namespace std;
  * @param length hexadecimal string length
  */
 template <typename T>
-static string toHex(T value, psize length = sizeof(T) << 1) noexcept
+static std::string toHex(T value, psize length = sizeof(T) << 1) noexcept
 {
 	constexpr const char* digits = "0123456789ABCDEF";
-	string hex(length, '0');
+	std::string hex(length, '0');
 	for (psize i = 0, j = (length - 1) * 4; i < length; i++, j -= 4)
 		hex[i] = digits[(value >> j) & 0x0f];
 	return hex;
@@ -42,7 +41,7 @@ static string toHex(T value, psize length = sizeof(T) << 1) noexcept
  * @brief Converts hexadecimal string to the 32bit integer value.
  * @param[in] hex target hexadecimal string
  */
-static uint32 toInt32(const string& hex) noexcept
+static uint32 toInt32(const std::string& hex) noexcept
 {
 	return std::stoul(hex, nullptr, 16);
 }
@@ -50,7 +49,7 @@ static uint32 toInt32(const string& hex) noexcept
  * @brief Converts hexadecimal string to the 64bit integer value.
  * @param[in] hex target hexadecimal string
  */
-static uint64 toInt64(const string& hex) noexcept
+static uint64 toInt64(const std::string& hex) noexcept
 {
 	return std::stoull(hex, nullptr, 16);
 }
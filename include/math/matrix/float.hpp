@@ -67,7 +67,7 @@ struct float2x2
 	float2& operator[](psize i) noexcept
 	{
 		assert(i <= 1);
-		return ((float2*)this)[i];
+		return (&c0)[i];
 	}
 	/**
 	 * @brief Returns matrix column by index.
@@ -76,7 +76,7 @@ struct float2x2
 	float2 operator[](psize i) const noexcept
 	{
 		assert(i <= 1);
-		return ((float2*)this)[i];
+		return (&c0)[i];
 	}
 
 	/*******************************************************************************************************************
@@ -115,12 +115,12 @@ struct float2x2
 	 * @brief Returns true if matrices have the same values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator==(const float2x2& m) const noexcept { return memcmp(this, &m, sizeof(float2x2)) == 0; }
+	bool operator==(const float2x2& m) const noexcept { return std::memcmp(this, &m, sizeof(float2x2)) == 0; }
 	/**
 	 * @brief Returns true if matrices have different values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator!=(const float2x2& m) const noexcept { return memcmp(this, &m, sizeof(float2x2)) != 0; }
+	bool operator!=(const float2x2& m) const noexcept { return std::memcmp(this, &m, sizeof(float2x2)) != 0; }
 
 	static const float2x2 zero, one, minusOne, identity;
 };
@@ -179,7 +179,7 @@ struct float3x3
 	float3& operator[](psize i) noexcept
 	{
 		assert(i <= 2);
-		return ((float3*)this)[i];
+		return (&c0)[i];
 	}
 	/**
 	 * @brief Returns matrix column by index.
@@ -188,7 +188,7 @@ struct float3x3
 	const float3& operator[](psize i) const noexcept
 	{
 		assert(i <= 2);
-		return ((float3*)this)[i];
+		return (&c0)[i];
 	}
 
 	/*******************************************************************************************************************
@@ -229,12 +229,12 @@ struct float3x3
 	 * @brief Returns true if matrices have the same values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator==(const float3x3& m) const noexcept { return memcmp(this, &m, sizeof(float3x3)) == 0; }
+	bool operator==(const float3x3& m) const noexcept { return std::memcmp(this, &m, sizeof(float3x3)) == 0; }
 	/**
 	 * @brief Returns true if matrices have different values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator!=(const float3x3& m) const noexcept { return memcmp(this, &m, sizeof(float3x3)) != 0; }
+	bool operator!=(const float3x3& m) const noexcept { return std::memcmp(this, &m, sizeof(float3x3)) != 0; }
 
 	static const float3x3 zero, one, minusOne, identity;
 };
@@ -301,7 +301,7 @@ struct float4x3
 	float3& operator[](psize i) noexcept
 	{
 		assert(i <= 2);
-		return ((float3*)this)[i];
+		return (&c0)[i];
 	}
 	/**
 	 * @brief Returns matrix column by index.
@@ -310,7 +310,7 @@ struct float4x3
 	const float3& operator[](psize i) const noexcept
 	{
 		assert(i <= 2);
-		return ((float3*)this)[i];
+		return (&c0)[i];
 	}
 
 	/*******************************************************************************************************************
@@ -335,12 +335,12 @@ struct float4x3
 	 * @brief Returns true if matrices have the same values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator==(const float4x3& m) const noexcept { return memcmp(this, &m, sizeof(float4x3)) == 0; }
+	bool operator==(const float4x3& m) const noexcept { return std::memcmp(this, &m, sizeof(float4x3)) == 0; }
 	/**
 	 * @brief Returns true if matrices have different values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator!=(const float4x3& m) const noexcept { return memcmp(this, &m, sizeof(float4x3)) != 0; }
+	bool operator!=(const float4x3& m) const noexcept { return std::memcmp(this, &m, sizeof(float4x3)) != 0; }
 
 	static const float4x3 zero, one, minusOne, identity;
 };
@@ -424,7 +424,7 @@ struct float4x4
 	float4& operator[](psize i) noexcept
 	{
 		assert(i <= 3);
-		return ((float4*)this)[i];
+		return (&c0)[i];
 	}
 	/**
 	 * @brief Returns matrix column by index.
@@ -433,7 +433,7 @@ struct float4x4
 	const float4& operator[](psize i) const noexcept
 	{
 		assert(i <= 3);
-		return ((float4*)this)[i];
+		return (&c0)[i];
 	}
 
 	/*******************************************************************************************************************
@@ -476,12 +476,12 @@ struct float4x4
 	 * @brief Returns true if matrices have the same values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator==(const float4x4& m) const noexcept { return memcmp(this, &m, sizeof(float4x4)) == 0; }
+	bool operator==(const float4x4& m) const noexcept { return std::memcmp(this, &m, sizeof(float4x4)) == 0; }
 	/**
 	 * @brief Returns true if matrices have different values.
 	 * @param[in] m another matrix to compare with
 	 */
-	bool operator!=(const float4x4& m) const noexcept { return memcmp(this, &m, sizeof(float4x4)) != 0; }
+	bool operator!=(const float4x4& m) const noexcept { return std::memcmp(this, &m, sizeof(float4x4)) != 0; }
 
 	/**
 	 * @brief Model matrix without any transformations.
@@ -118,8 +118,8 @@ struct quat : public float4
 		auto xx = w * w - x * x - y * y + z * z;
 
 		// Avoid atan2(0, 0) - handle singularity - Matiis
-		if (std::abs(xx) <= numeric_limits<float>::epsilon() ||
-			std::abs(yy) <= numeric_limits<float>::epsilon())
+		if (std::abs(xx) <= std::numeric_limits<float>::epsilon() ||
+			std::abs(yy) <= std::numeric_limits<float>::epsilon())
 		{
 			return 2.0f * std::atan2(x, w);
 		}
@@ -176,7 +176,7 @@ static quat slerp(const quat& a, const quat& b, float t) noexcept
 		cosTheta = -cosTheta;
 	}
 
-	if (cosTheta > 1.0f - numeric_limits<float>::epsilon())
+	if (cosTheta > 1.0f - std::numeric_limits<float>::epsilon())
 	{
 		return quat(lerp(a.x, c.x, t), lerp(a.y, c.y, t), lerp(a.z, c.z, t), lerp(a.w, c.w, t));
 	}
@@ -0,0 +1,115 @@
+// Copyright 2022-2024 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief SIMD instruction set detection and common vector register constants.
+ */
+
+#pragma once
+#include "math/types.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP == 2)
+/**
+ * @brief SSE2 instruction set is available on the target CPU.
+ */
+#define MATH_SIMD_SSE2 1
+#include <emmintrin.h>
+#if defined(__SSE4_1__) || defined(__AVX__)
+/**
+ * @brief SSE4.1 instruction set is available on the target CPU.
+ */
+#define MATH_SIMD_SSE4_1 1
+#include <smmintrin.h>
+#endif
+#if defined(__AVX2__)
+/**
+ * @brief AVX2 instruction set is available on the target CPU.
+ */
+#define MATH_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+#if defined(__FMA__) || defined(__AVX2__)
+/**
+ * @brief FMA3 instruction set is available on the target CPU.
+ */
+#define MATH_SIMD_FMA 1
+#include <immintrin.h>
+#endif
+#if defined(__F16C__)
+/**
+ * @brief F16C half precision conversion instructions are available on the target CPU.
+ */
+#define MATH_SIMD_F16C 1
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+/**
+ * @brief NEON instruction set is available on the target CPU.
+ */
+#define MATH_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace math
+{
+
+#if MATH_SIMD_SSE2
+/**
+ * @brief Precomputed sign bit mask for four 32bit integers. (0x80000000)
+ * @details Loaded from the constant pool instead of being rematerialized at every use.
+ */
+inline const __m128i simdSignMask32x4 = _mm_set1_epi32((int32)0x80000000u);
+/**
+ * @brief Precomputed all bits set mask for four 32bit integers. (0xFFFFFFFF)
+ * @details Loaded from the constant pool instead of being rematerialized at every use.
+ */
+inline const __m128i simdAllBits32x4 = _mm_set1_epi32((int32)0xFFFFFFFFu);
+/**
+ * @brief Precomputed one value for four 32bit integers. (1)
+ * @details Loaded from the constant pool instead of being rematerialized at every use.
+ */
+inline const __m128i simdOne32x4 = _mm_set1_epi32(1);
+#endif
+
+/***********************************************************************************************************************
+ * @brief Enables or disables flushing of denormal floats to zero. (FTZ and DAZ)
+ * @details
+ * Denormal operands fall back to microcode assists on most CPUs, costing tens of cycles per operation in audio
+ * and simulation style loops that decay toward zero. Flushing trades values below ~1.18e-38 for full speed.
+ * Affects only the calling thread, and only the SSE/NEON pipelines.
+ *
+ * @param enable target denormal flushing state
+ */
+static void setFlushDenormalsToZero(bool enable) noexcept
+{
+#if MATH_SIMD_SSE2
+	if (enable)
+		_mm_setcsr(_mm_getcsr() | 0x8040u);
+	else
+		_mm_setcsr(_mm_getcsr() & ~0x8040u);
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	uint64 fpcr;
+	__asm__ volatile("mrs %0, fpcr" : "=r"(fpcr));
+	if (enable)
+		fpcr |= 1ull << 24u;
+	else
+		fpcr &= ~(1ull << 24u);
+	__asm__ volatile("msr fpcr, %0" : : "r"(fpcr));
+#else
+	(void)enable;
+#endif
+}
+
+} // namespace math
\ No newline at end of file
@@ -26,9 +26,9 @@ namespace math
 
 /**
  * @brief Sphere structure. (In 3D space)
- * @details Defined by a position point and radius.
+ * @details Defined by a position point and radius. Aligned for the whole struct vector loads.
  */
-struct Sphere
+struct alignas(16) Sphere
 {
 	float3 position;
 	float radius;
@@ -52,13 +52,30 @@ inline const Sphere Sphere::one = Sphere(0.5f);
 inline const Sphere Sphere::two = Sphere(1.0f);
 inline const Sphere Sphere::half = Sphere(0.25f);
 
+/**
+ * @brief Returns true if spheres have the same binary representation.
+ * @details Use it for hash map keys and deduplication, unlike == it treats NaN values as equal.
+ *
+ * @param[in] a first sphere to binary compare
+ * @param[in] b second sphere to binary compare
+ */
+MATH_PURE_FUNC static bool isBinaryEqual(const Sphere& a, const Sphere& b) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto m = _mm_cmpeq_epi32(_mm_load_si128((const __m128i*)&a), _mm_load_si128((const __m128i*)&b));
+	return _mm_movemask_epi8(m) == 0xFFFF;
+#else
+	return std::memcmp(&a, &b, sizeof(Sphere)) == 0;
+#endif
+}
+
 /**
  * @brief Returns true if point is inside the sphere.
  *
  * @param[in] sphere target sphere to check
  * @param[in] point target point in the space
  */
-static constexpr bool isInside(const Sphere& sphere, const float3& point) noexcept
+MATH_PURE_FUNC static constexpr bool isInside(const Sphere& sphere, const float3& point) noexcept
 {
 	auto difference = sphere.position - point;
   	return length2(difference) < sphere.radius * sphere.radius;
@@ -70,10 +87,23 @@ static constexpr bool isInside(const Sphere& sphere, const float3& point) noexce
  * @param[in] sphere target sphere to use
  * @param[in] point target point in 3D space
  */
-static float3 closestPoint(const Sphere& sphere, const float3& point) noexcept
+MATH_PURE_FUNC static float3 closestPoint(const Sphere& sphere, const float3& point) noexcept
 {
-    auto sphereToPoint = normalize(point - sphere.position);
-    return sphere.position + sphereToPoint * sphere.radius;
+	auto d = point - sphere.position;
+	auto d2 = length2(d);
+#if MATH_SIMD_SSE2
+	// Clamp guards the degenerate zero length case. (rsqrt(0) = inf)
+	auto inv = _mm_cvtss_f32(_mm_min_ss(_mm_rsqrt_ss(_mm_set_ss(d2)), _mm_set_ss(1.0e19f)));
+	inv = inv * (1.5f - 0.5f * d2 * inv * inv); // Newton-Raphson refinement step.
+	return sphere.position + d * (sphere.radius * inv);
+#elif MATH_SIMD_NEON
+	auto r = vrsqrte_f32(vdup_n_f32(d2));
+	r = vmul_f32(r, vrsqrts_f32(vmul_f32(vdup_n_f32(d2), r), r));
+	auto inv = std::min(vget_lane_f32(r, 0), 1.0e19f);
+	return sphere.position + d * (sphere.radius * inv);
+#else
+	return sphere.position + d * (sphere.radius / std::sqrt(d2));
+#endif
 }
 
 /**
@@ -82,7 +112,7 @@ static float3 closestPoint(const Sphere& sphere, const float3& point) noexcept
  * @param[in] a first sphere to check
  * @param[in] b second sphere to chech
  */
-static constexpr bool isIntersected(const Sphere& a, const Sphere& b) noexcept
+MATH_PURE_FUNC static constexpr bool isIntersected(const Sphere& a, const Sphere& b) noexcept
 {
     auto d = a.position - b.position;
     auto s = a.radius + b.radius;
@@ -94,11 +124,172 @@ static constexpr bool isIntersected(const Sphere& a, const Sphere& b) noexcept
  * @param[in] a target sphere to check
  * @param[in] b target AABB to chech
  */
-static bool isIntersected(const Sphere& a, const Aabb& b) noexcept
+MATH_PURE_FUNC static bool isIntersected(const Sphere& a, const Aabb& b) noexcept
 {
 	auto c = closestPoint(b, a.position);
 	auto d2 = length2(a.position - c);
 	return d2 < a.radius * a.radius;
 }
 
+/***********************************************************************************************************************
+ * @brief Sphere array in the structure of arrays layout. (SoA)
+ * @details Used by the batched broadphase tests to utilize full SIMD width.
+ */
+struct SphereSoA
+{
+	const float* positionX; /**< Sphere position X component array. */
+	const float* positionY; /**< Sphere position Y component array. */
+	const float* positionZ; /**< Sphere position Z component array. */
+	const float* radius;    /**< Sphere radius array. */
+	psize count;            /**< Total sphere count in the arrays. */
+
+	/**
+	 * @brief Creates a new sphere structure of arrays.
+	 *
+	 * @param[in] positionX sphere position X component array
+	 * @param[in] positionY sphere position Y component array
+	 * @param[in] positionZ sphere position Z component array
+	 * @param[in] radius sphere radius array
+	 * @param count total sphere count in the arrays
+	 */
+	constexpr SphereSoA(const float* positionX = nullptr, const float* positionY = nullptr,
+		const float* positionZ = nullptr, const float* radius = nullptr, psize count = 0) noexcept :
+		positionX(positionX), positionY(positionY), positionZ(positionZ), radius(radius), count(count) { }
+};
+
+/**
+ * @brief Returns a bitmask of eight sphere intersection tests. (Broadphase)
+ * @details Tests the sphere against eight consecutive spheres from the array at once.
+ *
+ * @param[in] sphere target sphere to check
+ * @param[in] spheres sphere array in the SoA layout
+ * @param offset first sphere offset in the array (multiple of 8)
+ */
+MATH_PURE_FUNC static uint32 isIntersected8(const Sphere& sphere, const SphereSoA& spheres, psize offset) noexcept
+{
+	assert(offset + 8 <= spheres.count);
+#if MATH_SIMD_AVX2
+	auto qx = _mm256_set1_ps(sphere.position.x), qy = _mm256_set1_ps(sphere.position.y);
+	auto qz = _mm256_set1_ps(sphere.position.z), qr = _mm256_set1_ps(sphere.radius);
+	auto dx = _mm256_sub_ps(qx, _mm256_loadu_ps(spheres.positionX + offset));
+	auto dy = _mm256_sub_ps(qy, _mm256_loadu_ps(spheres.positionY + offset));
+	auto dz = _mm256_sub_ps(qz, _mm256_loadu_ps(spheres.positionZ + offset));
+	auto d2 = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+	auto s = _mm256_add_ps(qr, _mm256_loadu_ps(spheres.radius + offset));
+	auto mask = _mm256_cmp_ps(d2, _mm256_mul_ps(s, s), _CMP_LE_OQ);
+	return (uint32)_mm256_movemask_ps(mask);
+#elif MATH_SIMD_NEON
+	uint32 mask = 0;
+	for (psize i = 0; i < 2; i++)
+	{
+		auto o = offset + i * 4;
+		auto dx = vsubq_f32(vdupq_n_f32(sphere.position.x), vld1q_f32(spheres.positionX + o));
+		auto dy = vsubq_f32(vdupq_n_f32(sphere.position.y), vld1q_f32(spheres.positionY + o));
+		auto dz = vsubq_f32(vdupq_n_f32(sphere.position.z), vld1q_f32(spheres.positionZ + o));
+		auto d2 = vmlaq_f32(vmlaq_f32(vmulq_f32(dz, dz), dy, dy), dx, dx);
+		auto s = vaddq_f32(vdupq_n_f32(sphere.radius), vld1q_f32(spheres.radius + o));
+		auto c = vshrq_n_u32(vcleq_f32(d2, vmulq_f32(s, s)), 31);
+		mask |= (vgetq_lane_u32(c, 0) | (vgetq_lane_u32(c, 1) << 1) |
+			(vgetq_lane_u32(c, 2) << 2) | (vgetq_lane_u32(c, 3) << 3)) << (i * 4);
+	}
+	return mask;
+#else
+	uint32 mask = 0;
+	for (psize i = 0; i < 8; i++)
+	{
+		auto d = sphere.position - float3(spheres.positionX[offset + i],
+			spheres.positionY[offset + i], spheres.positionZ[offset + i]);
+		auto s = sphere.radius + spheres.radius[offset + i];
+		mask |= (uint32)(length2(d) <= s * s) << i;
+	}
+	return mask;
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Returns a bitmask of eight sphere and AABB intersection tests. (Broadphase)
+ * @details Computes eight closest points branchlessly with min/max and compares squared distances.
+ *
+ * @param[in] sphere target sphere to check
+ * @param[in] aabbs AABB array in the SoA layout
+ * @param offset first AABB offset in the array (multiple of 8)
+ */
+MATH_PURE_FUNC static uint32 isIntersected8(const Sphere& sphere, const AabbSoA& aabbs, psize offset) noexcept
+{
+	assert(offset + 8 <= aabbs.count);
+#if MATH_SIMD_AVX2
+	auto sx = _mm256_set1_ps(sphere.position.x);
+	auto sy = _mm256_set1_ps(sphere.position.y);
+	auto sz = _mm256_set1_ps(sphere.position.z);
+	auto dx = _mm256_sub_ps(sx, _mm256_max_ps(_mm256_min_ps(sx,
+		_mm256_loadu_ps(aabbs.maxX + offset)), _mm256_loadu_ps(aabbs.minX + offset)));
+	auto dy = _mm256_sub_ps(sy, _mm256_max_ps(_mm256_min_ps(sy,
+		_mm256_loadu_ps(aabbs.maxY + offset)), _mm256_loadu_ps(aabbs.minY + offset)));
+	auto dz = _mm256_sub_ps(sz, _mm256_max_ps(_mm256_min_ps(sz,
+		_mm256_loadu_ps(aabbs.maxZ + offset)), _mm256_loadu_ps(aabbs.minZ + offset)));
+	auto d2 = _mm256_fmadd_ps(dx, dx, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dz, dz)));
+	auto mask = _mm256_cmp_ps(d2, _mm256_set1_ps(sphere.radius * sphere.radius), _CMP_LT_OQ);
+	return (uint32)_mm256_movemask_ps(mask);
+#elif MATH_SIMD_NEON
+	uint32 mask = 0;
+	for (psize i = 0; i < 2; i++)
+	{
+		auto o = offset + i * 4;
+		auto sx = vdupq_n_f32(sphere.position.x);
+		auto sy = vdupq_n_f32(sphere.position.y);
+		auto sz = vdupq_n_f32(sphere.position.z);
+		auto dx = vsubq_f32(sx, vmaxq_f32(vminq_f32(sx,
+			vld1q_f32(aabbs.maxX + o)), vld1q_f32(aabbs.minX + o)));
+		auto dy = vsubq_f32(sy, vmaxq_f32(vminq_f32(sy,
+			vld1q_f32(aabbs.maxY + o)), vld1q_f32(aabbs.minY + o)));
+		auto dz = vsubq_f32(sz, vmaxq_f32(vminq_f32(sz,
+			vld1q_f32(aabbs.maxZ + o)), vld1q_f32(aabbs.minZ + o)));
+		auto d2 = vmlaq_f32(vmlaq_f32(vmulq_f32(dz, dz), dy, dy), dx, dx);
+		auto c = vshrq_n_u32(vcltq_f32(d2, vdupq_n_f32(sphere.radius * sphere.radius)), 31);
+		mask |= (vgetq_lane_u32(c, 0) | (vgetq_lane_u32(c, 1) << 1) |
+			(vgetq_lane_u32(c, 2) << 2) | (vgetq_lane_u32(c, 3) << 3)) << (i * 4);
+	}
+	return mask;
+#else
+	uint32 mask = 0;
+	for (psize i = 0; i < 8; i++)
+	{
+		auto aabb = Aabb(float3(aabbs.minX[offset + i], aabbs.minY[offset + i], aabbs.minZ[offset + i]),
+			float3(aabbs.maxX[offset + i], aabbs.maxY[offset + i], aabbs.maxZ[offset + i]));
+		mask |= (uint32)isIntersected(sphere, aabb) << i;
+	}
+	return mask;
+#endif
+}
+
+/**
+ * @brief Tests the sphere against the whole AABB array. (Broadphase)
+ * @details Prefetches the AABB streams ahead to hide the cache miss latency.
+ *
+ * @param[in] sphere target sphere to check
+ * @param[in] aabbs AABB array in the SoA layout (count is multiple of 8)
+ * @param[out] masks resulting intersection bitmask array (one byte per eight AABBs)
+ */
+static void isIntersected(const Sphere& sphere, const AabbSoA& aabbs, uint8* masks) noexcept
+{
+	assert(aabbs.count % 8 == 0);
+	auto maskCount = aabbs.count / 8;
+	for (psize i = 0; i < maskCount; i++)
+	{
+#if MATH_SIMD_SSE2
+		if ((i + 8) * 8 < aabbs.count)
+		{
+			auto offset = (i + 8) * 8; // Prefetch eight blocks ahead of the kernel.
+			_mm_prefetch((const char*)(aabbs.minX + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(aabbs.minY + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(aabbs.minZ + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(aabbs.maxX + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(aabbs.maxY + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(aabbs.maxZ + offset), _MM_HINT_T0);
+		}
+#endif
+		masks[i] = (uint8)isIntersected8(sphere, aabbs, i * 8);
+	}
+}
+
 } // namespace math
\ No newline at end of file
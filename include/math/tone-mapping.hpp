@@ -58,4 +58,86 @@ static float3 gammaCorrection(const float3& color) noexcept
 	return pow(color, float3(1.0f / defaultGamma));
 }
 
+/***********************************************************************************************************************
+ * @brief Applies fast approximate gamma correction to the specified color.
+ * @details See the @ref gammaCorrection() and @ref fastPow().
+ *
+ * @param[in] color target color to gamma correct
+ * @param invGamma inverse gamma correction value (1.0/x)
+ */
+static float3 fastGammaCorrection(const float3& color, float invGamma) noexcept
+{
+	return float3(fastPow(color.x, invGamma), fastPow(color.y, invGamma), fastPow(color.z, invGamma));
+}
+/**
+ * @brief Applies fast approximate gamma correction to the specified color.
+ * @details See the @ref gammaCorrection() and @ref fastPow().
+ * @param[in] color target color to gamma correct
+ */
+static float3 fastGammaCorrection(const float3& color) noexcept
+{
+	return fastGammaCorrection(color, 1.0f / defaultGamma);
+}
+
+#if MATH_SIMD_AVX2
+static __m256 fastLog2(__m256 v) noexcept
+{
+	auto bits = _mm256_castps_si256(v);
+	auto e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+	auto m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits,
+		_mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+	auto p = _mm256_set1_ps(-0.056570851f);
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(0.44717955f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.4699568f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(2.8212026f));
+	p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.7417939f));
+	return _mm256_fmadd_ps(p, _mm256_set1_ps(1.4426950f), e);
+}
+static __m256 fastExp2(__m256 v) noexcept
+{
+	v = _mm256_max_ps(v, _mm256_set1_ps(-127.0f));
+	auto f = _mm256_floor_ps(v);
+	auto x = _mm256_sub_ps(v, f);
+	auto p = _mm256_set1_ps(0.0013333558f);
+	p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.0096181291f));
+	p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.055504109f));
+	p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.24022651f));
+	p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(0.69314718f));
+	p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(1.0f));
+	auto s = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(
+		_mm256_cvtps_epi32(f), _mm256_set1_epi32(127)), 23));
+	return _mm256_mul_ps(s, p);
+}
+#endif
+
+/**
+ * @brief Applies fast approximate gamma correction to the pixel buffer.
+ * @details Processes two RGBA pixels per iteration on AVX2 targets, alpha channel is preserved.
+ *
+ * @param[in,out] rgba target RGBA pixel buffer to gamma correct
+ * @param pixelCount total pixel count in the buffer
+ * @param invGamma inverse gamma correction value (1.0/x)
+ */
+static void fastGammaCorrection(float* rgba, psize pixelCount, float invGamma) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto alphaMask = _mm256_castsi256_ps(_mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1));
+	auto g = _mm256_set1_ps(invGamma);
+	for (; i + 2 <= pixelCount; i += 2)
+	{
+		auto c = _mm256_loadu_ps(rgba + i * 4);
+		auto corrected = fastExp2(_mm256_mul_ps(fastLog2(c), g));
+		_mm256_storeu_ps(rgba + i * 4, _mm256_blendv_ps(corrected, c, alphaMask));
+	}
+#endif
+	for (; i < pixelCount; i++)
+	{
+		auto p = rgba + i * 4;
+		p[0] = fastPow(p[0], invGamma);
+		p[1] = fastPow(p[1], invGamma);
+		p[2] = fastPow(p[2], invGamma);
+	}
+}
+
 } // namespace math
\ No newline at end of file
@@ -19,6 +19,8 @@
  */
 
 #pragma once
+#include "math/ray.hpp"
+#include "math/half.hpp"
 #include "math/vector.hpp"
 
 namespace math
@@ -56,10 +58,71 @@ struct Triangle
 	constexpr Triangle operator/(const float3& v) const noexcept { return Triangle(p0 / v, p1 / v, p2 / v); }
 	constexpr Triangle operator+(const float3& v) const noexcept { return Triangle(p0 + v, p1 + v, p2 + v); }
 	constexpr Triangle operator-(const float3& v) const noexcept { return Triangle(p0 - v, p1 - v, p2 - v); }
-	Triangle& operator*=(const float3& v) noexcept { p0 *= v; p1 *= v; p2 *= v; return *this; }
-	Triangle& operator/=(const float3& v) noexcept { p0 /= v; p1 /= v; p2 /= v; return *this; }
-	Triangle& operator+=(const float3& v) noexcept { p0 += v; p1 += v; p2 += v; return *this; }
-	Triangle& operator-=(const float3& v) noexcept { p0 -= v; p1 -= v; p2 -= v; return *this; }
+	Triangle& operator*=(const float3& v) noexcept
+	{
+	#if MATH_SIMD_AVX2
+		// One 256bit operation over the first eight floats instead of three 128bit ones.
+		auto m = _mm256_setr_ps(v.x, v.y, v.z, v.x, v.y, v.z, v.x, v.y);
+		_mm256_storeu_ps((float*)&p0, _mm256_mul_ps(_mm256_loadu_ps((const float*)&p0), m));
+		p2.z *= v.z;
+	#else
+		p0 *= v; p1 *= v; p2 *= v;
+	#endif
+		return *this;
+	}
+	Triangle& operator/=(const float3& v) noexcept
+	{
+	#if MATH_SIMD_AVX2
+		auto m = _mm256_setr_ps(v.x, v.y, v.z, v.x, v.y, v.z, v.x, v.y);
+		_mm256_storeu_ps((float*)&p0, _mm256_div_ps(_mm256_loadu_ps((const float*)&p0), m));
+		p2.z /= v.z;
+	#else
+		p0 /= v; p1 /= v; p2 /= v;
+	#endif
+		return *this;
+	}
+	Triangle& operator+=(const float3& v) noexcept
+	{
+	#if MATH_SIMD_AVX2
+		auto m = _mm256_setr_ps(v.x, v.y, v.z, v.x, v.y, v.z, v.x, v.y);
+		_mm256_storeu_ps((float*)&p0, _mm256_add_ps(_mm256_loadu_ps((const float*)&p0), m));
+		p2.z += v.z;
+	#else
+		p0 += v; p1 += v; p2 += v;
+	#endif
+		return *this;
+	}
+	Triangle& operator-=(const float3& v) noexcept
+	{
+	#if MATH_SIMD_AVX2
+		auto m = _mm256_setr_ps(v.x, v.y, v.z, v.x, v.y, v.z, v.x, v.y);
+		_mm256_storeu_ps((float*)&p0, _mm256_sub_ps(_mm256_loadu_ps((const float*)&p0), m));
+		p2.z -= v.z;
+	#else
+		p0 -= v; p1 -= v; p2 -= v;
+	#endif
+		return *this;
+	}
+	constexpr Triangle operator*(float n) const noexcept
+	{
+		return Triangle(p0 * float3(n), p1 * float3(n), p2 * float3(n));
+	}
+	constexpr Triangle operator/(float n) const noexcept
+	{
+		return Triangle(p0 / float3(n), p1 / float3(n), p2 / float3(n));
+	}
+	constexpr Triangle operator+(float n) const noexcept
+	{
+		return Triangle(p0 + float3(n), p1 + float3(n), p2 + float3(n));
+	}
+	constexpr Triangle operator-(float n) const noexcept
+	{
+		return Triangle(p0 - float3(n), p1 - float3(n), p2 - float3(n));
+	}
+	Triangle& operator*=(float n) noexcept { p0 *= n; p1 *= n; p2 *= n; return *this; }
+	Triangle& operator/=(float n) noexcept { p0 /= n; p1 /= n; p2 /= n; return *this; }
+	Triangle& operator+=(float n) noexcept { p0 += n; p1 += n; p2 += n; return *this; }
+	Triangle& operator-=(float n) noexcept { p0 -= n; p1 -= n; p2 -= n; return *this; }
 	constexpr bool operator==(const Triangle& t) const noexcept { return p0 == t.p0 && p1 == t.p1 && p2 == t.p2; }
 	constexpr bool operator!=(const Triangle& t) const noexcept { return p0 != t.p0 || p1 != t.p1 || p2 != t.p2; }
 };
@@ -70,15 +133,13 @@ struct Triangle
  * @param[in] sphere target triangle to check
  * @param[in] point target point in the space
  */
-static constexpr bool isInside(const Triangle& triangle, const float3& point) noexcept
+MATH_PURE_FUNC static constexpr bool isInside(const Triangle& triangle, const float3& point) noexcept
 {
 	auto p0 = triangle.p0 - point;
 	auto p1 = triangle.p1 - point;
 	auto p2 = triangle.p2 - point;
 	auto u = cross(p1, p2), v = cross(p2, p0), w = cross(p0, p1);
-	if (dot(u, v) < 0.0f || dot(u, w) < 0.0f)
-		return false;
-	return true;
+	return !((dot(u, v) < 0.0f) | (dot(u, w) < 0.0f)); // Bitwise OR is branchless.
 }
 
 /**
@@ -88,19 +149,581 @@ static constexpr bool isInside(const Triangle& triangle, const float3& point) no
  * @param[in] triangle target triangle to use
  * @param[in] point target point in space
  */
-static constexpr float3 calcBarycentric(const Triangle& triangle, const float3& point) noexcept
+MATH_PURE_FUNC static constexpr float3 calcBarycentric(const Triangle& triangle, const float3& point) noexcept
 {
-	// Cramer's rule
 	auto p0 = triangle.p0;
 	auto v0 = triangle.p1 - p0;
 	auto v1 = triangle.p2 - p0;
 	auto v2 = point - p0;
+#ifdef MATH_BARYCENTRIC_CRAMER
+	// Cramer's rule
 	auto d00 = dot(v0, v0), d01 = dot(v0, v1), d11 = dot(v1, v1);
 	auto d20 = dot(v2, v0), d21 = dot(v2, v1);
 	auto invDenom = 1.0f / (d00 * d11 - d01 * d01);
 	auto v = (d11 * d20 - d01 * d21) * invDenom;
 	auto w = (d00 * d21 - d01 * d20) * invDenom;
+#else
+	// Cross product formulation, component chains are independent.
+	auto n = cross(v0, v1);
+	auto invDenom = 1.0f / dot(n, n);
+	auto v = dot(cross(v2, v1), n) * invDenom;
+	auto w = dot(cross(v0, v2), n) * invDenom;
+#endif
 	return float3(1.0f - v - w, v, w);
 }
 
+/**
+ * @brief Returns true if point is inside the triangle and calculates its barycentric.
+ * @details
+ * Fused @ref isInside() and @ref calcBarycentric(), computes the shared edge vectors once.
+ * Tests the point projected onto the triangle plane, returns true only if the barycentric is non-negative.
+ *
+ * @param[in] triangle target triangle to check
+ * @param[in] point target point in the space
+ * @param[out] barycentric point barycentric coordinates (set only when inside)
+ */
+static constexpr bool isInside(const Triangle& triangle, const float3& point, float3& barycentric) noexcept
+{
+	auto v0 = triangle.p1 - triangle.p0;
+	auto v1 = triangle.p2 - triangle.p0;
+	auto v2 = point - triangle.p0;
+	auto n = cross(v0, v1);
+	auto denom = dot(n, n);
+	auto v = dot(cross(v2, v1), n);
+	auto w = dot(cross(v0, v2), n);
+	auto u = denom - v - w;
+	if ((v < 0.0f) | (w < 0.0f) | (u < 0.0f))
+		return false;
+	auto invDenom = 1.0f / denom;
+	barycentric = float3(u * invDenom, v * invDenom, w * invDenom);
+	return true;
+}
+
+/***********************************************************************************************************************
+ * @brief Triangle with a precomputed barycentric basis.
+ * @details Use it when the same triangle is tested against many points.
+ */
+struct PreparedTriangle
+{
+	float3 p0;      /**< First triangle vertex position. */
+	float3 v0;      /**< First triangle edge vector. (p1 - p0) */
+	float3 v1;      /**< Second triangle edge vector. (p2 - p0) */
+	float d00;      /**< Cached dot product of the first edge with itself. */
+	float d01;      /**< Cached dot product of the first and second edges. */
+	float d11;      /**< Cached dot product of the second edge with itself. */
+	float invDenom; /**< Cached inverse barycentric denominator. */
+
+	/**
+	 * @brief Precomputes the barycentric basis of the triangle.
+	 * @param[in] triangle target triangle to prepare
+	 */
+	constexpr explicit PreparedTriangle(const Triangle& triangle) noexcept :
+		p0(triangle.p0), v0(triangle.p1 - triangle.p0), v1(triangle.p2 - triangle.p0),
+		d00(dot(v0, v0)), d01(dot(v0, v1)), d11(dot(v1, v1)),
+		invDenom(1.0f / (d00 * d11 - d01 * d01)) { }
+};
+
+/**
+ * @brief Calculates triangle barycentric using the precomputed basis.
+ * @details See the @ref calcBarycentric(). Skips the five triangle-only dot products per call.
+ *
+ * @param[in] triangle target prepared triangle to use
+ * @param[in] point target point in space
+ */
+MATH_PURE_FUNC static constexpr float3 calcBarycentric(const PreparedTriangle& triangle, const float3& point) noexcept
+{
+	auto v2 = point - triangle.p0;
+	auto d20 = dot(v2, triangle.v0), d21 = dot(v2, triangle.v1);
+	auto v = (triangle.d11 * d20 - triangle.d01 * d21) * triangle.invDenom;
+	auto w = (triangle.d00 * d21 - triangle.d01 * d20) * triangle.invDenom;
+	return float3(1.0f - v - w, v, w);
+}
+
+/***********************************************************************************************************************
+ * @brief Triangle (polygon) structure in the half precision storage format.
+ * @details Halves the memory traffic of the bandwidth bound mesh workloads.
+ */
+struct TriangleF16
+{
+	half data[9]; /**< Triangle vertex positions. (half precision) */
+
+	/**
+	 * @brief Creates a new zero size half precision triangle (polygon) structure.
+	 */
+	constexpr TriangleF16() = default;
+	/**
+	 * @brief Creates a new half precision triangle (polygon) structure.
+	 * @param[in] triangle target single precision triangle to convert
+	 */
+	explicit TriangleF16(const Triangle& triangle) noexcept
+	{
+		convertToHalf((const float*)&triangle, data, 9);
+	}
+
+	/**
+	 * @brief Converts triangle back to the single precision format.
+	 */
+	explicit operator Triangle() const noexcept
+	{
+		Triangle triangle;
+		convertToFloat(data, (float*)&triangle, 9);
+		return triangle;
+	}
+
+	constexpr bool operator==(const TriangleF16& t) const noexcept
+	{
+		for (int32 i = 0; i < 9; i++)
+		{
+			if (data[i] != t.data[i])
+				return false;
+		}
+		return true;
+	}
+	constexpr bool operator!=(const TriangleF16& t) const noexcept { return !(*this == t); }
+};
+
+/***********************************************************************************************************************
+ * @brief Triangle or polygon structure. (In 2D space)
+ * @details Used for the flat queries like navigation meshes, UI hit testing.
+ */
+struct Triangle2D
+{
+	/**
+	 * @brief Triangle point count. (Polygon)
+	 */
+	static constexpr int32 pointCount = 3;
+
+	float2 p0; /**< First triangle vertex position. */
+	float2 p1; /**< Second triangle vertex position. */
+	float2 p2; /**< Third triangle vertex position. */
+
+	/**
+	 * @brief Creates a new triangle (polygon) structure. (In 2D space)
+	 *
+	 * @param p0 first triangle vertex position in 2D space
+	 * @param p1 second triangle vertex position in 2D space
+	 * @param p2 third triangle vertex position in 2D space
+	 */
+	constexpr Triangle2D(float2 p0, float2 p1, float2 p2) noexcept : p0(p0), p1(p1), p2(p2) { }
+	/**
+	 * @brief Creates a new zero size triangle (polygon) structure. (In 2D space)
+	 */
+	constexpr Triangle2D() = default;
+
+	constexpr bool operator==(const Triangle2D& t) const noexcept { return p0 == t.p0 && p1 == t.p1 && p2 == t.p2; }
+	constexpr bool operator!=(const Triangle2D& t) const noexcept { return p0 != t.p0 || p1 != t.p1 || p2 != t.p2; }
+};
+
+/**
+ * @brief Returns true if point is inside the 2D triangle. (Any winding order)
+ * @details Cheaper than the 3D test, three 2D edge crosses instead of crosses and dots.
+ *
+ * @param[in] triangle target triangle to check
+ * @param point target point on the plane
+ */
+MATH_PURE_FUNC static constexpr bool isInside(const Triangle2D& triangle, float2 point) noexcept
+{
+	auto e0 = (triangle.p1.x - triangle.p0.x) * (point.y - triangle.p0.y) -
+		(triangle.p1.y - triangle.p0.y) * (point.x - triangle.p0.x);
+	auto e1 = (triangle.p2.x - triangle.p1.x) * (point.y - triangle.p1.y) -
+		(triangle.p2.y - triangle.p1.y) * (point.x - triangle.p1.x);
+	auto e2 = (triangle.p0.x - triangle.p2.x) * (point.y - triangle.p2.y) -
+		(triangle.p0.y - triangle.p2.y) * (point.x - triangle.p2.x);
+	// Point is inside when no edge signs disagree, bitwise operators are branchless.
+	return !(((e0 < 0.0f) | (e1 < 0.0f) | (e2 < 0.0f)) & ((e0 > 0.0f) | (e1 > 0.0f) | (e2 > 0.0f)));
+}
+
+/***********************************************************************************************************************
+ * @brief Calculates where ray intersects the triangle.
+ * @details Moller-Trumbore algorithm, tests both triangle sides.
+ * @return True if ray intersects the triangle, otherwise false.
+ *
+ * @param[in] triangle target triangle to raycast
+ * @param[in] ray target ray in the space
+ * @param[out] distance distance to the intersection point
+ */
+static bool raycast(const Triangle& triangle, const Ray& ray, float& distance) noexcept
+{
+	auto e1 = triangle.p1 - triangle.p0;
+	auto e2 = triangle.p2 - triangle.p0;
+	auto h = cross(ray.getDirection(), e2);
+	auto a = dot(e1, h);
+	if (std::fabs(a) < 1.0e-7f)
+		return false; // Ray is parallel to the triangle plane.
+	auto invA = 1.0f / a;
+	auto s = ray.origin - triangle.p0;
+	auto u = dot(s, h) * invA;
+	if ((u < 0.0f) | (u > 1.0f))
+		return false;
+	auto q = cross(s, e1);
+	auto v = dot(ray.getDirection(), q) * invA;
+	if ((v < 0.0f) | (u + v > 1.0f))
+		return false;
+	auto t = dot(e2, q) * invA;
+	if (t < 0.0f)
+		return false;
+	distance = t;
+	return true;
+}
+/**
+ * @brief Returns true if ray intersects the triangle.
+ *
+ * @param[in] triangle target triangle to raycast
+ * @param[in] ray target ray in the space
+ */
+static bool raycast(const Triangle& triangle, const Ray& ray) noexcept
+{
+	float distance;
+	return raycast(triangle, ray, distance);
+}
+
+/***********************************************************************************************************************
+ * @brief Multiplies triangle array by the specified value.
+ * @details Streams the triangles as one packed float array instead of per point operations.
+ *
+ * @param[in] triangles target triangle array to multiply
+ * @param[out] results resulting triangle array (can be the same)
+ * @param count total triangle count in the arrays
+ * @param[in] multiplier target value to multiply by
+ */
+static void multiplyTriangles(const Triangle* triangles,
+	Triangle* results, psize count, const float3& multiplier) noexcept
+{
+	auto source = (const float*)triangles;
+	auto destination = (float*)results;
+	auto total = count * 3 * 3;
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	// Multiplier component pattern repeats every 24 floats. (lcm of 3 and 8)
+	auto x = multiplier.x, y = multiplier.y, z = multiplier.z;
+	auto m0 = _mm256_setr_ps(x, y, z, x, y, z, x, y);
+	auto m1 = _mm256_setr_ps(z, x, y, z, x, y, z, x);
+	auto m2 = _mm256_setr_ps(y, z, x, y, z, x, y, z);
+	for (; i + 24 <= total; i += 24)
+	{
+		_mm256_storeu_ps(destination + i, _mm256_mul_ps(_mm256_loadu_ps(source + i), m0));
+		_mm256_storeu_ps(destination + i + 8, _mm256_mul_ps(_mm256_loadu_ps(source + i + 8), m1));
+		_mm256_storeu_ps(destination + i + 16, _mm256_mul_ps(_mm256_loadu_ps(source + i + 16), m2));
+	}
+#endif
+	for (; i < total; i++)
+		destination[i] = source[i] * multiplier[i % 3];
+}
+
+/***********************************************************************************************************************
+ * @brief Triangle array in the structure of arrays layout. (SoA)
+ * @details Used by the batched triangle queries to utilize full SIMD width.
+ */
+struct TriangleSoA
+{
+	const float* p0x; /**< First vertex X component array. */
+	const float* p0y; /**< First vertex Y component array. */
+	const float* p0z; /**< First vertex Z component array. */
+	const float* p1x; /**< Second vertex X component array. */
+	const float* p1y; /**< Second vertex Y component array. */
+	const float* p1z; /**< Second vertex Z component array. */
+	const float* p2x; /**< Third vertex X component array. */
+	const float* p2y; /**< Third vertex Y component array. */
+	const float* p2z; /**< Third vertex Z component array. */
+	psize count;      /**< Total triangle count in the arrays. */
+};
+
+/**
+ * @brief Converts triangle array to the structure of arrays layout.
+ * @details Transposes four triangles at a time with vector shuffles.
+ *
+ * @param[in] triangles target triangle array to convert
+ * @param count total triangle count in the arrays
+ * @param[out] p0x first vertex X component array
+ * @param[out] p0y first vertex Y component array
+ * @param[out] p0z first vertex Z component array
+ * @param[out] p1x second vertex X component array
+ * @param[out] p1y second vertex Y component array
+ * @param[out] p1z second vertex Z component array
+ * @param[out] p2x third vertex X component array
+ * @param[out] p2y third vertex Y component array
+ * @param[out] p2z third vertex Z component array
+ */
+static void toSoA(const Triangle* triangles, psize count, float* p0x, float* p0y, float* p0z,
+	float* p1x, float* p1y, float* p1z, float* p2x, float* p2y, float* p2z) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_SSE2
+	float* const arrays[9] = { p0x, p0y, p0z, p1x, p1y, p1z, p2x, p2y, p2z };
+	// The last group is left to the scalar tail, its final vector load would read past the array.
+	for (; i + 4 < count; i += 4)
+	{
+		auto source = (const float*)(triangles + i);
+		for (psize p = 0; p < 9; p += 3)
+		{
+			auto a = _mm_loadu_ps(source + p);
+			auto b = _mm_loadu_ps(source + p + 9);
+			auto c = _mm_loadu_ps(source + p + 18);
+			auto d = _mm_loadu_ps(source + p + 27);
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+			_mm_storeu_ps(arrays[p] + i, a);
+			_mm_storeu_ps(arrays[p + 1] + i, b);
+			_mm_storeu_ps(arrays[p + 2] + i, c);
+		}
+	}
+#endif
+	for (; i < count; i++)
+	{
+		auto triangle = triangles[i];
+		p0x[i] = triangle.p0.x; p0y[i] = triangle.p0.y; p0z[i] = triangle.p0.z;
+		p1x[i] = triangle.p1.x; p1y[i] = triangle.p1.y; p1z[i] = triangle.p1.z;
+		p2x[i] = triangle.p2.x; p2y[i] = triangle.p2.y; p2z[i] = triangle.p2.z;
+	}
+}
+/**
+ * @brief Converts structure of arrays layout back to the triangle array.
+ * @details Inverse of the @ref toSoA() transpose.
+ *
+ * @param[in] triangles triangle array in the SoA layout
+ * @param[out] results resulting triangle array
+ */
+static void fromSoA(const TriangleSoA& triangles, Triangle* results) noexcept
+{
+	auto count = triangles.count;
+	psize i = 0;
+#if MATH_SIMD_SSE2
+	// The last group is left to the scalar tail, its final vector store would write past the array.
+	for (; i + 4 < count; i += 4)
+	{
+		auto destination = (float*)(results + i);
+		auto a0 = _mm_loadu_ps(triangles.p0x + i), b0 = _mm_loadu_ps(triangles.p0y + i);
+		auto c0 = _mm_loadu_ps(triangles.p0z + i), d0 = _mm_setzero_ps();
+		auto a1 = _mm_loadu_ps(triangles.p1x + i), b1 = _mm_loadu_ps(triangles.p1y + i);
+		auto c1 = _mm_loadu_ps(triangles.p1z + i), d1 = _mm_setzero_ps();
+		auto a2 = _mm_loadu_ps(triangles.p2x + i), b2 = _mm_loadu_ps(triangles.p2y + i);
+		auto c2 = _mm_loadu_ps(triangles.p2z + i), d2 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(a0, b0, c0, d0);
+		_MM_TRANSPOSE4_PS(a1, b1, c1, d1);
+		_MM_TRANSPOSE4_PS(a2, b2, c2, d2);
+		// Stores ascend by address, each next one overwrites the garbage fourth lane of the previous.
+		_mm_storeu_ps(destination, a0); _mm_storeu_ps(destination + 3, a1); _mm_storeu_ps(destination + 6, a2);
+		_mm_storeu_ps(destination + 9, b0); _mm_storeu_ps(destination + 12, b1); _mm_storeu_ps(destination + 15, b2);
+		_mm_storeu_ps(destination + 18, c0); _mm_storeu_ps(destination + 21, c1); _mm_storeu_ps(destination + 24, c2);
+		_mm_storeu_ps(destination + 27, d0); _mm_storeu_ps(destination + 30, d1); _mm_storeu_ps(destination + 33, d2);
+	}
+#endif
+	for (; i < count; i++)
+	{
+		results[i] = Triangle(
+			float3(triangles.p0x[i], triangles.p0y[i], triangles.p0z[i]),
+			float3(triangles.p1x[i], triangles.p1y[i], triangles.p1z[i]),
+			float3(triangles.p2x[i], triangles.p2y[i], triangles.p2z[i]));
+	}
+}
+
+/**
+ * @brief Returns the inside state of the point for eight triangles.
+ * @details See the @ref isInside(). Each vector lane processes a different triangle.
+ *
+ * @param[in] triangles triangle array in the SoA layout
+ * @param[in] point target point in the space
+ * @param offset first triangle offset in the array (multiple of 8)
+ * @return Bitmask where N-th bit is set if the point is inside the N-th triangle.
+ */
+static uint32 isInside8(const TriangleSoA& triangles, const float3& point, psize offset) noexcept
+{
+	assert(offset + 8 <= triangles.count);
+#if MATH_SIMD_AVX2
+	auto px = _mm256_set1_ps(point.x), py = _mm256_set1_ps(point.y), pz = _mm256_set1_ps(point.z);
+	auto p0x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p0x + offset), px);
+	auto p0y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p0y + offset), py);
+	auto p0z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p0z + offset), pz);
+	auto p1x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1x + offset), px);
+	auto p1y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1y + offset), py);
+	auto p1z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1z + offset), pz);
+	auto p2x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2x + offset), px);
+	auto p2y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2y + offset), py);
+	auto p2z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2z + offset), pz);
+	auto ux = _mm256_fmsub_ps(p1y, p2z, _mm256_mul_ps(p1z, p2y));
+	auto uy = _mm256_fmsub_ps(p1z, p2x, _mm256_mul_ps(p1x, p2z));
+	auto uz = _mm256_fmsub_ps(p1x, p2y, _mm256_mul_ps(p1y, p2x));
+	auto vx = _mm256_fmsub_ps(p2y, p0z, _mm256_mul_ps(p2z, p0y));
+	auto vy = _mm256_fmsub_ps(p2z, p0x, _mm256_mul_ps(p2x, p0z));
+	auto vz = _mm256_fmsub_ps(p2x, p0y, _mm256_mul_ps(p2y, p0x));
+	auto wx = _mm256_fmsub_ps(p0y, p1z, _mm256_mul_ps(p0z, p1y));
+	auto wy = _mm256_fmsub_ps(p0z, p1x, _mm256_mul_ps(p0x, p1z));
+	auto wz = _mm256_fmsub_ps(p0x, p1y, _mm256_mul_ps(p0y, p1x));
+	auto duv = _mm256_fmadd_ps(ux, vx, _mm256_fmadd_ps(uy, vy, _mm256_mul_ps(uz, vz)));
+	auto duw = _mm256_fmadd_ps(ux, wx, _mm256_fmadd_ps(uy, wy, _mm256_mul_ps(uz, wz)));
+	auto zero = _mm256_setzero_ps();
+	auto inside = _mm256_and_ps(_mm256_cmp_ps(duv, zero,
+		_CMP_NLT_UQ), _mm256_cmp_ps(duw, zero, _CMP_NLT_UQ));
+	return (uint32)_mm256_movemask_ps(inside);
+#else
+	uint32 mask = 0u;
+	for (psize i = 0; i < 8; i++)
+	{
+		auto triangle = Triangle(
+			float3(triangles.p0x[offset + i], triangles.p0y[offset + i], triangles.p0z[offset + i]),
+			float3(triangles.p1x[offset + i], triangles.p1y[offset + i], triangles.p1z[offset + i]),
+			float3(triangles.p2x[offset + i], triangles.p2y[offset + i], triangles.p2z[offset + i]));
+		mask |= (uint32)isInside(triangle, point) << i;
+	}
+	return mask;
+#endif
+}
+
+/**
+ * @brief Calculates barycentrics of eight triangles relative to the point.
+ * @details See the @ref calcBarycentric(). Uses all vector lanes without horizontal operations.
+ *
+ * @param[in] triangles triangle array in the SoA layout
+ * @param[in] point target point in space
+ * @param offset first triangle offset in the array (multiple of 8)
+ * @param[out] u first barycentric coordinate array (8 values)
+ * @param[out] v second barycentric coordinate array (8 values)
+ * @param[out] w third barycentric coordinate array (8 values)
+ */
+static void calcBarycentric8(const TriangleSoA& triangles, const float3& point,
+	psize offset, float* u, float* v, float* w) noexcept
+{
+	assert(offset + 8 <= triangles.count);
+#if MATH_SIMD_AVX2
+	auto p0x = _mm256_loadu_ps(triangles.p0x + offset);
+	auto p0y = _mm256_loadu_ps(triangles.p0y + offset);
+	auto p0z = _mm256_loadu_ps(triangles.p0z + offset);
+	auto v0x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1x + offset), p0x);
+	auto v0y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1y + offset), p0y);
+	auto v0z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1z + offset), p0z);
+	auto v1x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2x + offset), p0x);
+	auto v1y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2y + offset), p0y);
+	auto v1z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2z + offset), p0z);
+	auto v2x = _mm256_sub_ps(_mm256_set1_ps(point.x), p0x);
+	auto v2y = _mm256_sub_ps(_mm256_set1_ps(point.y), p0y);
+	auto v2z = _mm256_sub_ps(_mm256_set1_ps(point.z), p0z);
+	auto d00 = _mm256_fmadd_ps(v0x, v0x, _mm256_fmadd_ps(v0y, v0y, _mm256_mul_ps(v0z, v0z)));
+	auto d01 = _mm256_fmadd_ps(v0x, v1x, _mm256_fmadd_ps(v0y, v1y, _mm256_mul_ps(v0z, v1z)));
+	auto d11 = _mm256_fmadd_ps(v1x, v1x, _mm256_fmadd_ps(v1y, v1y, _mm256_mul_ps(v1z, v1z)));
+	auto d20 = _mm256_fmadd_ps(v2x, v0x, _mm256_fmadd_ps(v2y, v0y, _mm256_mul_ps(v2z, v0z)));
+	auto d21 = _mm256_fmadd_ps(v2x, v1x, _mm256_fmadd_ps(v2y, v1y, _mm256_mul_ps(v2z, v1z)));
+	auto denom = _mm256_fmsub_ps(d00, d11, _mm256_mul_ps(d01, d01));
+#ifdef MATH_FAST_MATH
+	// Reciprocal estimation with one Newton-Raphson step instead of the full division.
+	auto invDenom = _mm256_rcp_ps(denom);
+	invDenom = _mm256_mul_ps(invDenom, _mm256_fnmadd_ps(denom, invDenom, _mm256_set1_ps(2.0f)));
+#else
+	auto invDenom = _mm256_div_ps(_mm256_set1_ps(1.0f), denom);
+#endif
+	auto vv = _mm256_mul_ps(_mm256_fmsub_ps(d11, d20, _mm256_mul_ps(d01, d21)), invDenom);
+	auto ww = _mm256_mul_ps(_mm256_fmsub_ps(d00, d21, _mm256_mul_ps(d01, d20)), invDenom);
+	auto uu = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), vv), ww);
+	_mm256_storeu_ps(u, uu); _mm256_storeu_ps(v, vv); _mm256_storeu_ps(w, ww);
+#else
+	for (psize i = 0; i < 8; i++)
+	{
+		auto triangle = Triangle(
+			float3(triangles.p0x[offset + i], triangles.p0y[offset + i], triangles.p0z[offset + i]),
+			float3(triangles.p1x[offset + i], triangles.p1y[offset + i], triangles.p1z[offset + i]),
+			float3(triangles.p2x[offset + i], triangles.p2y[offset + i], triangles.p2z[offset + i]));
+		auto barycentric = calcBarycentric(triangle, point);
+		u[i] = barycentric.x; v[i] = barycentric.y; w[i] = barycentric.z;
+	}
+#endif
+}
+
+/**
+ * @brief Calculates where ray intersects eight triangles.
+ * @details See the @ref raycast(). Each vector lane processes a different triangle.
+ *
+ * @param[in] triangles triangle array in the SoA layout
+ * @param[in] ray target ray in the space
+ * @param offset first triangle offset in the array (multiple of 8)
+ * @param[out] distances distances to the intersection points (8 values, valid where the bit is set)
+ * @return Bitmask where N-th bit is set if the ray intersects the N-th triangle.
+ */
+static uint32 raycast8(const TriangleSoA& triangles, const Ray& ray, psize offset, float* distances) noexcept
+{
+	assert(offset + 8 <= triangles.count);
+#if MATH_SIMD_AVX2
+	auto direction = ray.getDirection();
+	auto dx = _mm256_set1_ps(direction.x), dy = _mm256_set1_ps(direction.y), dz = _mm256_set1_ps(direction.z);
+	auto p0x = _mm256_loadu_ps(triangles.p0x + offset);
+	auto p0y = _mm256_loadu_ps(triangles.p0y + offset);
+	auto p0z = _mm256_loadu_ps(triangles.p0z + offset);
+	auto e1x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1x + offset), p0x);
+	auto e1y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1y + offset), p0y);
+	auto e1z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p1z + offset), p0z);
+	auto e2x = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2x + offset), p0x);
+	auto e2y = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2y + offset), p0y);
+	auto e2z = _mm256_sub_ps(_mm256_loadu_ps(triangles.p2z + offset), p0z);
+	auto hx = _mm256_fmsub_ps(dy, e2z, _mm256_mul_ps(dz, e2y));
+	auto hy = _mm256_fmsub_ps(dz, e2x, _mm256_mul_ps(dx, e2z));
+	auto hz = _mm256_fmsub_ps(dx, e2y, _mm256_mul_ps(dy, e2x));
+	auto a = _mm256_fmadd_ps(e1x, hx, _mm256_fmadd_ps(e1y, hy, _mm256_mul_ps(e1z, hz)));
+	auto absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+	auto valid = _mm256_cmp_ps(_mm256_and_ps(a, absMask), _mm256_set1_ps(1.0e-7f), _CMP_GE_OQ);
+	auto invA = _mm256_div_ps(_mm256_set1_ps(1.0f), a);
+	auto sx = _mm256_sub_ps(_mm256_set1_ps(ray.origin.x), p0x);
+	auto sy = _mm256_sub_ps(_mm256_set1_ps(ray.origin.y), p0y);
+	auto sz = _mm256_sub_ps(_mm256_set1_ps(ray.origin.z), p0z);
+	auto u = _mm256_mul_ps(_mm256_fmadd_ps(sx, hx,
+		_mm256_fmadd_ps(sy, hy, _mm256_mul_ps(sz, hz))), invA);
+	auto qx = _mm256_fmsub_ps(sy, e1z, _mm256_mul_ps(sz, e1y));
+	auto qy = _mm256_fmsub_ps(sz, e1x, _mm256_mul_ps(sx, e1z));
+	auto qz = _mm256_fmsub_ps(sx, e1y, _mm256_mul_ps(sy, e1x));
+	auto v = _mm256_mul_ps(_mm256_fmadd_ps(dx, qx,
+		_mm256_fmadd_ps(dy, qy, _mm256_mul_ps(dz, qz))), invA);
+	auto t = _mm256_mul_ps(_mm256_fmadd_ps(e2x, qx,
+		_mm256_fmadd_ps(e2y, qy, _mm256_mul_ps(e2z, qz))), invA);
+	auto zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+	valid = _mm256_and_ps(valid, _mm256_cmp_ps(u, zero, _CMP_GE_OQ));
+	valid = _mm256_and_ps(valid, _mm256_cmp_ps(u, one, _CMP_LE_OQ));
+	valid = _mm256_and_ps(valid, _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+	valid = _mm256_and_ps(valid, _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ));
+	valid = _mm256_and_ps(valid, _mm256_cmp_ps(t, zero, _CMP_GE_OQ));
+	_mm256_storeu_ps(distances, t);
+	return (uint32)_mm256_movemask_ps(valid);
+#else
+	uint32 mask = 0u;
+	for (psize i = 0; i < 8; i++)
+	{
+		auto triangle = Triangle(
+			float3(triangles.p0x[offset + i], triangles.p0y[offset + i], triangles.p0z[offset + i]),
+			float3(triangles.p1x[offset + i], triangles.p1y[offset + i], triangles.p1z[offset + i]),
+			float3(triangles.p2x[offset + i], triangles.p2y[offset + i], triangles.p2z[offset + i]));
+		mask |= (uint32)raycast(triangle, ray, distances[i]) << i;
+	}
+	return mask;
+#endif
+}
+
+/**
+ * @brief Calculates where ray intersects the whole triangle array.
+ * @details See the @ref raycast8(). Prefetches the component arrays ahead of the kernel.
+ *
+ * @param[in] triangles triangle array in the SoA layout (count multiple of 8)
+ * @param[in] ray target ray in the space
+ * @param[out] masks resulting hit bitmask array (count / 8)
+ * @param[out] distances distances to the intersection points (count values)
+ */
+static void raycast(const TriangleSoA& triangles, const Ray& ray, uint8* masks, float* distances) noexcept
+{
+	assert(triangles.count % 8 == 0);
+	auto maskCount = triangles.count / 8;
+	for (psize i = 0; i < maskCount; i++)
+	{
+	#if MATH_SIMD_SSE2
+		if ((i + 8) * 8 < triangles.count)
+		{
+			auto offset = (i + 8) * 8; // Prefetch eight blocks ahead of the kernel.
+			_mm_prefetch((const char*)(triangles.p0x + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p0y + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p0z + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p1x + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p1y + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p1z + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p2x + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p2y + offset), _MM_HINT_T0);
+			_mm_prefetch((const char*)(triangles.p2z + offset), _MM_HINT_T0);
+		}
+	#endif
+		masks[i] = (uint8)raycast8(triangles, ray, i * 8, distances + i * 8);
+	}
+}
+
 } // namespace math
\ No newline at end of file
@@ -63,4 +63,20 @@ typedef uint64_t uint64;
  */
 typedef size_t psize;
 
-} // namespace math
\ No newline at end of file
+} // namespace math
+
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief Marks function result as dependant only on the argument values. (No memory reads)
+ * @details Allows the compiler to eliminate repeated calls with the same arguments.
+ */
+#define MATH_CONST_FUNC [[gnu::const]]
+/**
+ * @brief Marks function result as dependant only on the arguments and memory they point to.
+ * @details Allows the compiler to eliminate repeated calls with the same arguments.
+ */
+#define MATH_PURE_FUNC [[gnu::pure]]
+#else
+#define MATH_CONST_FUNC
+#define MATH_PURE_FUNC
+#endif
\ No newline at end of file
@@ -19,6 +19,7 @@
  */
 
 #pragma once
+#include "math/half.hpp"
 #include "math/common.hpp"
 #include "math/vector/int.hpp"
 
@@ -29,7 +30,7 @@ namespace math
  * @brief Floating point 2 component vector structure.
  * @details Commonly used to represent: points, positions, directions, velocities, etc.
  */
-struct float2
+struct alignas(8) float2
 {
 	float x; /**< First vector component. */
 	float y; /**< Second vector component. */
@@ -64,7 +65,7 @@ struct float2
 	float& operator[](psize i) noexcept
 	{
 		assert(i <= 1);
-		return ((float*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -73,7 +74,7 @@ struct float2
 	float operator[](psize i) const noexcept
 	{
 		assert(i <= 1);
-		return ((float*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -100,7 +101,7 @@ struct float2
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept { return to_string(x) + " " + to_string(y); }
+	std::string toString() const noexcept { return math::toString((const float*)this, 2); }
 
 	constexpr float2 operator+(float2 v) const noexcept { return float2(x + v.x, y + v.y); }
 	constexpr float2 operator-(float2 v) const noexcept { return float2(x - v.x, y - v.y); }
@@ -116,12 +117,12 @@ struct float2
 	float2& operator*=(float n) noexcept { x *= n; y *= n; return *this; }
 	float2& operator/=(float n) noexcept { x /= n; y /= n; return *this; }
 	float2& operator=(float n) noexcept { x = n; y = n; return *this; }
-	constexpr bool operator==(float2 v) const noexcept { return x == v.x && y == v.y; }
-	constexpr bool operator!=(float2 v) const noexcept { return x != v.x || y != v.y; }
-	constexpr bool operator<(float2 v) const noexcept { return x < v.x && y < v.y; }
-	constexpr bool operator>(float2 v) const noexcept { return x > v.x && y > v.y; }
-	constexpr bool operator<=(float2 v) const noexcept { return x <= v.x && y <= v.y; }
-	constexpr bool operator>=(float2 v) const noexcept { return x >= v.x && y >= v.y; }
+	constexpr bool operator==(float2 v) const noexcept { return (x == v.x) & (y == v.y); }
+	constexpr bool operator!=(float2 v) const noexcept { return (x != v.x) | (y != v.y); }
+	constexpr bool operator<(float2 v) const noexcept { return (x < v.x) & (y < v.y); }
+	constexpr bool operator>(float2 v) const noexcept { return (x > v.x) & (y > v.y); }
+	constexpr bool operator<=(float2 v) const noexcept { return (x <= v.x) & (y <= v.y); }
+	constexpr bool operator>=(float2 v) const noexcept { return (x >= v.x) & (y >= v.y); }
 
 	static const float2 zero, one, minusOne, left, right, bottom, top;
 };
@@ -189,7 +190,7 @@ struct float3
 	float& operator[](psize i) noexcept
 	{
 		assert(i <= 2);
-		return ((float*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -198,7 +199,7 @@ struct float3
 	float operator[](psize i) const noexcept
 	{
 		assert(i <= 2);
-		return ((float*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -237,7 +238,7 @@ struct float3
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept { return to_string(x) + " " + to_string(y) + " " + to_string(z); }
+	std::string toString() const noexcept { return math::toString((const float*)this, 3); }
 
 	constexpr float3 operator+(const float3& v) const noexcept { return float3(x + v.x, y + v.y, z + v.z); }
 	constexpr float3 operator-(const float3& v) const noexcept { return float3(x - v.x, y - v.y, z - v.z); }
@@ -253,12 +254,12 @@ struct float3
 	float3& operator*=(float n) noexcept { x *= n; y *= n; z *= n; return *this; }
 	float3& operator/=(float n) noexcept { x /= n; y /= n; z /= n; return *this; }
 	float3& operator=(float n) noexcept { x = n; y = n; z = n; return *this; }
-	constexpr bool operator==(const float3& v) const noexcept { return x == v.x && y == v.y && z == v.z; }
-	constexpr bool operator!=(const float3& v) const noexcept { return x != v.x || y != v.y || z != v.z; }
-	constexpr bool operator<(const float3& v) const noexcept { return x < v.x && y < v.y && z < v.z; }
-	constexpr bool operator>(const float3& v) const noexcept { return x > v.x && y > v.y && z > v.z; }
-	constexpr bool operator<=(const float3& v) const noexcept { return x <= v.x && y <= v.y && z <= v.z; }
-	constexpr bool operator>=(const float3& v) const noexcept { return x >= v.x && y >= v.y && z >= v.z; }
+	constexpr bool operator==(const float3& v) const noexcept { return (x == v.x) & (y == v.y) & (z == v.z); }
+	constexpr bool operator!=(const float3& v) const noexcept { return (x != v.x) | (y != v.y) | (z != v.z); }
+	constexpr bool operator<(const float3& v) const noexcept { return (x < v.x) & (y < v.y) & (z < v.z); }
+	constexpr bool operator>(const float3& v) const noexcept { return (x > v.x) & (y > v.y) & (z > v.z); }
+	constexpr bool operator<=(const float3& v) const noexcept { return (x <= v.x) & (y <= v.y) & (z <= v.z); }
+	constexpr bool operator>=(const float3& v) const noexcept { return (x >= v.x) & (y >= v.y) & (z >= v.z); }
 
 	static const float3 zero, one, minusOne, left, right, bottom, top, back, front;
 };
@@ -277,7 +278,7 @@ inline const float3 float3::front = float3(0.0f, 0.0f, 1.0f);
  * @brief Floating point 4 component vector structure.
  * @details Commonly used to represent: points, positions, directions, velocities, etc.
  */
-struct float4
+struct alignas(16) float4
 {
 	float x; /**< First vector component. */
 	float y; /**< Second vector component. */
@@ -363,7 +364,7 @@ struct float4
 	float& operator[](psize i) noexcept
 	{
 		assert(i <= 3);
-		return ((float*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -372,7 +373,7 @@ struct float4
 	float operator[](psize i) const noexcept
 	{
 		assert(i <= 3);
-		return ((float*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -423,10 +424,7 @@ struct float4
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept
-	{
-		return to_string(x) + " " + to_string(y) + " " + to_string(z) + " " + to_string(w);
-	}
+	std::string toString() const noexcept { return math::toString((const float*)this, 4); }
 
 	constexpr float4 operator+(const float4& v) const noexcept { return float4(x + v.x, y + v.y, z + v.z, w + v.w); }
 	constexpr float4 operator-(const float4& v) const noexcept { return float4(x - v.x, y - v.y, z - v.z, w - v.w); }
@@ -442,12 +440,12 @@ struct float4
 	float4& operator*=(float n) noexcept { x *= n; y *= n; z *= n; w *= n; return *this; }
 	float4& operator/=(float n) noexcept { x /= n; y /= n; z /= n; w /= n; return *this; }
 	float4& operator=(float n) noexcept { x = n; y = n; z = n; w = n; return *this; }
-	constexpr bool operator==(const float4& v) const noexcept { return x == v.x && y == v.y && z == v.z && w == v.w; }
-	constexpr bool operator!=(const float4& v) const noexcept { return x != v.x || y != v.y || z != v.z || w != v.w; }
-	constexpr bool operator<(const float4& v) const noexcept { return x < v.x && y < v.y && z < v.z && w < v.w; }
-	constexpr bool operator>(const float4& v) const noexcept { return x > v.x && y > v.y && z > v.z && w > v.w; }
-	constexpr bool operator<=(const float4& v) const noexcept { return x <= v.x && y <= v.y && z <= v.z && w <= v.w; }
-	constexpr bool operator>=(const float4& v) const noexcept { return x >= v.x && y >= v.y && z >= v.z && w >= v.w; }
+	constexpr bool operator==(const float4& v) const noexcept { return (x == v.x) & (y == v.y) & (z == v.z) & (w == v.w); }
+	constexpr bool operator!=(const float4& v) const noexcept { return (x != v.x) | (y != v.y) | (z != v.z) | (w != v.w); }
+	constexpr bool operator<(const float4& v) const noexcept { return (x < v.x) & (y < v.y) & (z < v.z) & (w < v.w); }
+	constexpr bool operator>(const float4& v) const noexcept { return (x > v.x) & (y > v.y) & (z > v.z) & (w > v.w); }
+	constexpr bool operator<=(const float4& v) const noexcept { return (x <= v.x) & (y <= v.y) & (z <= v.z) & (w <= v.w); }
+	constexpr bool operator>=(const float4& v) const noexcept { return (x >= v.x) & (y >= v.y) & (z >= v.z) & (w >= v.w); }
 
 	static const float4 zero, one, minusOne;
 };
@@ -485,7 +483,11 @@ static constexpr bool operator>=(float n, float2 v) noexcept { return float2(n)
  * @param a first vector to binary compare
  * @param b secong vector to binary compare
  */
-static bool isBinaryLess(float2 a, float2 b) noexcept { return *((const int64*)&a) < *((const int64*)&b); }
+static bool isBinaryLess(float2 a, float2 b) noexcept
+{
+	int64 l, r; std::memcpy(&l, &a, sizeof(int64)); std::memcpy(&r, &b, sizeof(int64));
+	return l < r;
+}
 
 //**********************************************************************************************************************
 static constexpr float3 operator+(const float3& v, float n) noexcept { return float3(v.x + n, v.y + n, v.z + n); }
@@ -516,7 +518,13 @@ static constexpr bool operator>=(float n, const float3& v) noexcept { return flo
  * @param[in] a first vector to binary compare
  * @param[in] b secong vector to binary compare
  */
-static bool isBinaryLess(const float3& a, const float3& b) noexcept { return memcmp(&a, &b, sizeof(float) * 3) < 0; }
+static bool isBinaryLess(const float3& a, const float3& b) noexcept
+{
+	uint64 al, bl; uint32 ah, bh;
+	std::memcpy(&al, &a, sizeof(uint64)); std::memcpy(&ah, (const float*)&a + 2, sizeof(uint32));
+	std::memcpy(&bl, &b, sizeof(uint64)); std::memcpy(&bh, (const float*)&b + 2, sizeof(uint32));
+	return al < bl || (al == bl && ah < bh);
+}
 
 //**********************************************************************************************************************
 static constexpr float4 operator+(const float4& v, float n) noexcept { return float4(v.x + n, v.y + n, v.z + n, v.w + n); }
@@ -547,7 +555,13 @@ static constexpr bool operator>=(float n, const float4& v) noexcept { return flo
  * @param[in] a first vector to binary compare
  * @param[in] b secong vector to binary compare
  */
-static bool isBinaryLess(const float4& a, const float4& b) noexcept { return memcmp(&a, &b, sizeof(float) * 4) < 0; }
+static bool isBinaryLess(const float4& a, const float4& b) noexcept
+{
+	uint64 al, ah, bl, bh;
+	std::memcpy(&al, &a, sizeof(uint64)); std::memcpy(&ah, (const float*)&a + 2, sizeof(uint64));
+	std::memcpy(&bl, &b, sizeof(uint64)); std::memcpy(&bh, (const float*)&b + 2, sizeof(uint64));
+	return al < bl || (al == bl && ah < bh);
+}
 
 //**********************************************************************************************************************
 // TODO: possibly add more specific math functions like remquo, sph_neumann or dFdx.
@@ -556,17 +570,87 @@ static constexpr float2 min(float2 a, float2 b) noexcept { return float2(std::mi
 static constexpr float2 max(float2 a, float2 b) noexcept { return float2(std::max(a.x, b.x), std::max(a.y, b.y)); }
 static constexpr float2 min(float2 a, float2 b, float2 c) noexcept { return min(min(a, b), c); }
 static constexpr float2 max(float2 a, float2 b, float2 c) noexcept { return max(max(a, b), c); }
-static float2 abs(float2 v) noexcept { return float2(std::abs(v.x), std::abs(v.y)); }
+static float2 abs(float2 v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto r = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v)));
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#elif MATH_SIMD_NEON
+	float2 result; vst1_f32((float*)&result, vabs_f32(vld1_f32((const float*)&v)));
+	return result;
+#else
+	return float2(std::abs(v.x), std::abs(v.y));
+#endif
+}
 static float2 mod(float2 a, float2 b) noexcept { return float2(std::fmod(a.x, b.x), std::fmod(a.y, b.y)); }
+static float2 fastMod(float2 a, float2 b) noexcept { return float2(fastMod(a.x, b.x), fastMod(a.y, b.y)); }
 static float2 fma(float2 a, float2 b, float2 c) noexcept
 {
+#if MATH_SIMD_FMA
+	auto r = _mm_fmadd_ps(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&a)),
+		_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&b)),
+		_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&c)));
+	float2 v; _mm_storel_pi((__m64*)&v, r);
+	return v;
+#else
 	return float2(std::fma(a.x, b.x, c.x), std::fma(a.y, b.y, c.y));
+#endif
+}
+static float2 ceil(float2 v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto r = _mm_ceil_ps(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v)));
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	float2 result; vst1_f32((float*)&result, vrndp_f32(vld1_f32((const float*)&v)));
+	return result;
+#else
+	return float2(std::ceil(v.x), std::ceil(v.y));
+#endif
+}
+static float2 floor(float2 v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto r = _mm_floor_ps(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v)));
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	float2 result; vst1_f32((float*)&result, vrndm_f32(vld1_f32((const float*)&v)));
+	return result;
+#else
+	return float2(std::floor(v.x), std::floor(v.y));
+#endif
+}
+static float2 trunc(float2 v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto r = _mm_round_ps(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v)),
+		_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	float2 result; vst1_f32((float*)&result, vrnd_f32(vld1_f32((const float*)&v)));
+	return result;
+#else
+	return float2(std::trunc(v.x), std::trunc(v.y));
+#endif
 }
-static float2 ceil(float2 v) noexcept { return float2(std::ceil(v.x), std::ceil(v.y)); }
-static float2 floor(float2 v) noexcept { return float2(std::floor(v.x), std::floor(v.y)); }
-static float2 trunc(float2 v) noexcept { return float2(std::trunc(v.x), std::trunc(v.y)); }
 static float2 round(float2 v) noexcept { return float2(std::round(v.x), std::round(v.y)); }
 static float2 sign(float2 v) noexcept { return float2(sign(v.x), sign(v.y)); }
+/**
+ * @brief Extracts sign bits of the vector components. (including -0.0 and NaN signs)
+ * @param v target vector to extract sign bits
+ */
+static int32 signBits(float2 v) noexcept
+{
+#if MATH_SIMD_SSE2
+	return _mm_movemask_ps(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v))) & 0x3;
+#else
+	return (int32)std::signbit(v.x) | ((int32)std::signbit(v.y) << 1);
+#endif
+}
 static float2 exp(float2 v) noexcept { return float2(std::exp(v.x), std::exp(v.y)); }
 static float2 exp2(float2 v) noexcept { return float2(std::exp2(v.x), std::exp2(v.y)); }
 static float2 expm1(float2 v) noexcept { return float2(std::expm1(v.x), std::expm1(v.y)); }
@@ -575,10 +659,26 @@ static float2 log10(float2 v) noexcept { return float2(std::log10(v.x), std::log
 static float2 log2(float2 v) noexcept { return float2(std::log2(v.x), std::log2(v.y)); }
 static float2 log1p(float2 v) noexcept { return float2(std::log1p(v.x), std::log1p(v.y)); }
 static float2 pow(float2 a, float2 b) noexcept { return float2(std::pow(a.x, b.x), std::pow(a.y, b.y)); }
-static float2 sqrt(float2 v) noexcept { return float2(std::sqrt(v.x), std::sqrt(v.y)); }
+static float2 sqrt(float2 v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto r = _mm_sqrt_ps(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v)));
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	float2 result; vst1_f32((float*)&result, vsqrt_f32(vld1_f32((const float*)&v)));
+	return result;
+#else
+	return float2(std::sqrt(v.x), std::sqrt(v.y));
+#endif
+}
 static float2 cbrt(float2 v) noexcept { return float2(std::cbrt(v.x), std::cbrt(v.y)); }
 static float2 sin(float2 v) noexcept { return float2(std::sin(v.x), std::sin(v.y)); }
 static float2 cos(float2 v) noexcept { return float2(std::cos(v.x), std::cos(v.y)); }
+static void sinCos(float2 v, float2& s, float2& c) noexcept
+{
+	sinCos(v.x, s.x, c.x); sinCos(v.y, s.y, c.y);
+}
 static float2 tan(float2 v) noexcept { return float2(std::tan(v.x), std::tan(v.y)); }
 static float2 asin(float2 v) noexcept { return float2(std::asin(v.x), std::asin(v.y)); }
 static float2 acos(float2 v) noexcept { return float2(std::acos(v.x), std::acos(v.y)); }
@@ -595,18 +695,63 @@ static constexpr float2 clamp(float2 v, float2 min, float2 max) noexcept
 {
 	return float2(std::clamp(v.x, min.x, max.x), std::clamp(v.y, min.y, max.y));
 }
-static float2 repeat(float2 v) noexcept { return float2(repeat(v.x), repeat(v.y)); }
+static constexpr float2 select(uint2 c, float2 t, float2 f) noexcept
+{
+	return float2(c.x != 0u ? t.x : f.x, c.y != 0u ? t.y : f.y);
+}
+static constexpr uint2 equal(float2 a, float2 b) noexcept
+{
+	return uint2(a.x == b.x ? 0xFFFFFFFFu : 0u, a.y == b.y ? 0xFFFFFFFFu : 0u);
+}
+static constexpr uint2 notEqual(float2 a, float2 b) noexcept
+{
+	return uint2(a.x != b.x ? 0xFFFFFFFFu : 0u, a.y != b.y ? 0xFFFFFFFFu : 0u);
+}
+static float2 repeat(float2 v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto d = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v));
+	auto r = _mm_sub_ps(d, _mm_floor_ps(d));
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#else
+	return float2(repeat(v.x), repeat(v.y));
+#endif
+}
+static constexpr float sum(float2 v) noexcept { return v.x + v.y; }
 static constexpr float dot(float2 a, float2 b) noexcept { return a.x * b.x + a.y * b.y; }
 static float length(float2 v) noexcept { return std::sqrt(dot(v, v)); }
+/**
+ * @brief Calculates length of the vector without overflowing the squared sum. (Overflow safe)
+ * @details Use it when components can approach sqrt(FLT_MAX), costs more than @ref length().
+ * @param v target vector to calculate length
+ */
+static float safeLength(float2 v) noexcept { return std::hypot(v.x, v.y); }
 static constexpr float length2(float2 v) noexcept { return dot(v, v); }
 static float distance(float2 a, float2 b) noexcept { return length(a - b); }
 static constexpr float distance2(float2 a, float2 b) noexcept { return length2(a - b); }
+static constexpr bool lengthLessThan(float2 v, float r) noexcept { return length2(v) < r * r; }
+static constexpr bool distanceLessThan(float2 a, float2 b, float r) noexcept { return length2(a - b) < r * r; }
 static float2 normalize(float2 v) noexcept
 {
 	auto l = length(v);
 	assert(l > 0.0f);
 	return v * (1.0f / l);
 }
+static float2 fastRsqrt(float2 v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto d = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)&v));
+	auto r = _mm_rsqrt_ps(d);
+	r = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(
+		_mm_mul_ps(_mm_mul_ps(d, _mm_set1_ps(0.5f)), r), r)));
+	float2 result; _mm_storel_pi((__m64*)&result, r);
+	return result;
+#else
+	return float2(fastRsqrt(v.x), fastRsqrt(v.y));
+#endif
+}
+static float2 fastNormalize(float2 v) noexcept { return v * fastRsqrt(dot(v, v)); }
 static float2 lerp(float2 a, float2 b, float t) noexcept
 {
 	assert(t >= 0.0f);
@@ -617,10 +762,17 @@ static float2 lerpDelta(float2 a, float2 b, float f, float dt) noexcept
 {
 	return a + (1.0f - std::pow(f, dt)) * (b - a);
 }
+static float2 fastLerpDelta(float2 a, float2 b, float f, float dt) noexcept
+{
+	return a + (1.0f - fastPow(f, dt)) * (b - a);
+}
 static float2 gain(float2 x, float2 k) noexcept
 {
-	auto a = float2(0.5f) * pow(2.0f * ((x < 0.5f) ? x : 1.0f - x), k);
-	return (x < 0.5f) ? a : 1.0f - a;
+	return float2(gain(x.x, k.x), gain(x.y, k.y));
+}
+static float2 fastGain(float2 x, float2 k) noexcept
+{
+	return float2(fastGain(x.x, k.x), fastGain(x.y, k.y));
 }
 
 //**********************************************************************************************************************
@@ -639,6 +791,10 @@ static float3 mod(const float3& a, const float3& b) noexcept
 {
 	return float3(std::fmod(a.x, b.x), std::fmod(a.y, b.y), std::fmod(a.z, b.z));
 }
+static float3 fastMod(const float3& a, const float3& b) noexcept
+{
+	return float3(fastMod(a.x, b.x), fastMod(a.y, b.y), fastMod(a.z, b.z));
+}
 static float3 fma(const float3& a, const float3& b, const float3& c) noexcept
 {
 	return float3(std::fma(a.x, b.x, c.x), std::fma(a.y, b.y, c.y), std::fma(a.z, b.z, c.z));
@@ -648,6 +804,14 @@ static float3 floor(const float3& v) noexcept { return float3(std::floor(v.x), s
 static float3 trunc(const float3& v) noexcept { return float3(std::trunc(v.x), std::trunc(v.y), std::trunc(v.z)); }
 static float3 round(const float3& v) noexcept { return float3(std::round(v.x), std::round(v.y), std::round(v.z)); }
 static float3 sign(const float3& v) noexcept { return float3(sign(v.x), sign(v.y), sign(v.z)); }
+/**
+ * @brief Extracts sign bits of the vector components. (including -0.0 and NaN signs)
+ * @param[in] v target vector to extract sign bits
+ */
+static int32 signBits(const float3& v) noexcept
+{
+	return (int32)std::signbit(v.x) | ((int32)std::signbit(v.y) << 1) | ((int32)std::signbit(v.z) << 2);
+}
 static float3 exp(const float3& v) noexcept { return float3(std::exp(v.x), std::exp(v.y), std::exp(v.z)); }
 static float3 exp2(const float3& v) noexcept { return float3(std::exp2(v.x), std::exp2(v.y), std::exp2(v.z)); }
 static float3 expm1(const float3& v) noexcept { return float3(std::expm1(v.x), std::expm1(v.y), std::expm1(v.z)); }
@@ -663,6 +827,10 @@ static float3 sqrt(const float3& v) noexcept { return float3(std::sqrt(v.x), std
 static float3 cbrt(const float3& v) noexcept { return float3(std::cbrt(v.x), std::cbrt(v.y), std::cbrt(v.z)); }
 static float3 sin(const float3& v) noexcept { return float3(std::sin(v.x), std::sin(v.y), std::sin(v.z)); }
 static float3 cos(const float3& v) noexcept { return float3(std::cos(v.x), std::cos(v.y), std::cos(v.z)); }
+static void sinCos(const float3& v, float3& s, float3& c) noexcept
+{
+	sinCos(v.x, s.x, c.x); sinCos(v.y, s.y, c.y); sinCos(v.z, s.z, c.z);
+}
 static float3 tan(const float3& v) noexcept { return float3(std::tan(v.x), std::tan(v.y), std::tan(v.z)); }
 static float3 asin(const float3& v) noexcept { return float3(std::asin(v.x), std::asin(v.y), std::asin(v.z)); }
 static float3 acos(const float3& v) noexcept { return float3(std::acos(v.x), std::acos(v.y), std::acos(v.z)); }
@@ -682,17 +850,51 @@ static constexpr float3 clamp(const float3& v, const float3& min, const float3&
 {
 	return float3(std::clamp(v.x, min.x, max.x), std::clamp(v.y, min.y, max.y), std::clamp(v.z, min.z, max.z));
 }
+static constexpr float3 select(const uint3& c, const float3& t, const float3& f) noexcept
+{
+	return float3(c.x != 0u ? t.x : f.x, c.y != 0u ? t.y : f.y, c.z != 0u ? t.z : f.z);
+}
+static constexpr uint3 equal(const float3& a, const float3& b) noexcept
+{
+	return uint3(a.x == b.x ? 0xFFFFFFFFu : 0u, a.y == b.y ? 0xFFFFFFFFu : 0u, a.z == b.z ? 0xFFFFFFFFu : 0u);
+}
+static constexpr uint3 notEqual(const float3& a, const float3& b) noexcept
+{
+	return uint3(a.x != b.x ? 0xFFFFFFFFu : 0u, a.y != b.y ? 0xFFFFFFFFu : 0u, a.z != b.z ? 0xFFFFFFFFu : 0u);
+}
 static float3 repeat(const float3& v) noexcept { return float3(repeat(v.x), repeat(v.y), repeat(v.z)); }
+static constexpr float sum(const float3& v) noexcept { return v.x + v.y + v.z; }
 static constexpr float dot(const float3& a, const float3& b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z; }
 static constexpr float3 cross(const float3& a, const float3& b) noexcept
 {
 	return float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
 }
 static float length(const float3& v) noexcept { return std::sqrt(dot(v, v)); }
+/**
+ * @brief Calculates length of the vector without overflowing the squared sum. (Overflow safe)
+ * @details Scales by the biggest component magnitude, costs more than @ref length().
+ * @param[in] v target vector to calculate length
+ */
+static float safeLength(const float3& v) noexcept
+{
+	auto a = abs(v);
+	auto m = max(a.x, a.y, a.z);
+	if (m == 0.0f)
+		return 0.0f;
+	auto s = v * (1.0f / m);
+	return m * std::sqrt(dot(s, s));
+}
 static constexpr float length2(const float3& v) noexcept { return dot(v, v); }
 static float distance(const float3& a, const float3& b) noexcept { return length(a - b); }
 static constexpr float distance2(const float3& a, const float3& b) noexcept { return length2(a - b); }
+static constexpr bool lengthLessThan(const float3& v, float r) noexcept { return length2(v) < r * r; }
+static constexpr bool distanceLessThan(const float3& a, const float3& b, float r) noexcept
+{
+	return length2(a - b) < r * r;
+}
 static float3 normalize(const float3& v) noexcept { return v * (1.0f / length(v)); }
+static float3 fastRsqrt(const float3& v) noexcept { return float3(fastRsqrt(v.x), fastRsqrt(v.y), fastRsqrt(v.z)); }
+static float3 fastNormalize(const float3& v) noexcept { return v * fastRsqrt(dot(v, v)); }
 static float3 lerp(const float3& a, const float3& b, float t) noexcept
 {
 	assert(t >= 0.0f);
@@ -703,13 +905,44 @@ static float3 lerpDelta(const float3& a, const float3& b, float f, float dt) noe
 {
 	return a + (1.0f - std::pow(f, dt)) * (b - a);
 }
+static float3 fastLerpDelta(const float3& a, const float3& b, float f, float dt) noexcept
+{
+	return a + (1.0f - fastPow(f, dt)) * (b - a);
+}
 static float3 gain(const float3& x, const float3& k) noexcept
 {
-	auto a = float3(0.5f) * pow(2.0f * ((x < 0.5f) ? x : 1.0f - x), k);
-	return (x < 0.5f) ? a : 1.0f - a;
+	return float3(gain(x.x, k.x), gain(x.y, k.y), gain(x.z, k.z));
+}
+static float3 fastGain(const float3& x, const float3& k) noexcept
+{
+	return float3(fastGain(x.x, k.x), fastGain(x.y, k.y), fastGain(x.z, k.z));
 }
 
 //**********************************************************************************************************************
+#if MATH_SIMD_SSE2
+/**
+ * @brief Loads vector into the SIMD register. (Aligned)
+ * @param[in] v target vector to load
+ */
+static __m128 toSimd(const float4& v) noexcept { return _mm_load_ps((const float*)&v); }
+/**
+ * @brief Stores SIMD register to the vector. (Aligned)
+ * @param v target register to store
+ */
+static float4 fromSimd(__m128 v) noexcept { float4 r; _mm_store_ps((float*)&r, v); return r; }
+#elif MATH_SIMD_NEON
+/**
+ * @brief Loads vector into the SIMD register.
+ * @param[in] v target vector to load
+ */
+static float32x4_t toSimd(const float4& v) noexcept { return vld1q_f32((const float*)&v); }
+/**
+ * @brief Stores SIMD register to the vector.
+ * @param v target register to store
+ */
+static float4 fromSimd(float32x4_t v) noexcept { float4 r; vst1q_f32((float*)&r, v); return r; }
+#endif
+
 static constexpr float4 min(const float4& a, const float4& b) noexcept
 {
 	return float4(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z), std::min(a.w, b.w));
@@ -722,33 +955,102 @@ static constexpr float4 min(const float4& a, const float4& b, const float4& c) n
 static constexpr float4 max(const float4& a, const float4& b, const float4& c) noexcept { return max(max(a, b), c); }
 static float4 abs(const float4& v) noexcept
 {
+#if MATH_SIMD_SSE2
+	return fromSimd(_mm_andnot_ps(_mm_set1_ps(-0.0f), toSimd(v)));
+#elif MATH_SIMD_NEON
+	return fromSimd(vabsq_f32(toSimd(v)));
+#else
 	return float4(std::abs(v.x), std::abs(v.y), std::abs(v.z), std::abs(v.w));
+#endif
 }
 static float4 mod(const float4& a, const float4& b) noexcept
 {
 	return float4(std::fmod(a.x, b.x), std::fmod(a.y, b.y), std::fmod(a.z, b.z), std::fmod(a.w, b.w));
 }
+static float4 fastMod(const float4& a, const float4& b) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto d = toSimd(a), e = toSimd(b);
+	auto t = _mm_round_ps(_mm_div_ps(d, e), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	return fromSimd(_mm_sub_ps(d, _mm_mul_ps(t, e)));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	auto d = toSimd(a), e = toSimd(b);
+	return fromSimd(vsubq_f32(d, vmulq_f32(vrndq_f32(vdivq_f32(d, e)), e)));
+#else
+	return float4(fastMod(a.x, b.x), fastMod(a.y, b.y), fastMod(a.z, b.z), fastMod(a.w, b.w));
+#endif
+}
 static float4 fma(const float4& a, const float4& b, const float4& c) noexcept
 {
+#if MATH_SIMD_FMA
+	return fromSimd(_mm_fmadd_ps(toSimd(a), toSimd(b), toSimd(c)));
+#elif MATH_SIMD_NEON
+	return fromSimd(vfmaq_f32(toSimd(c), toSimd(a), toSimd(b)));
+#else
 	return float4(std::fma(a.x, b.x, c.x), std::fma(a.y, b.y, c.y), std::fma(a.z, b.z, c.z), std::fma(a.w, b.w, c.w));
+#endif
 }
 static float4 ceil(const float4& v) noexcept
 {
+#if MATH_SIMD_SSE4_1
+	return fromSimd(_mm_ceil_ps(toSimd(v)));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	return fromSimd(vrndpq_f32(toSimd(v)));
+#else
 	return float4(std::ceil(v.x), std::ceil(v.y), std::ceil(v.z), std::ceil(v.w));
+#endif
 }
 static float4 floor(const float4& v) noexcept
 {
+#if MATH_SIMD_SSE4_1
+	return fromSimd(_mm_floor_ps(toSimd(v)));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	return fromSimd(vrndmq_f32(toSimd(v)));
+#else
 	return float4(std::floor(v.x), std::floor(v.y), std::floor(v.z), std::floor(v.w));
+#endif
 }
 static float4 trunc(const float4& v) noexcept
 {
+#if MATH_SIMD_SSE4_1
+	return fromSimd(_mm_round_ps(toSimd(v), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	return fromSimd(vrndq_f32(toSimd(v)));
+#else
 	return float4(std::trunc(v.x), std::trunc(v.y), std::trunc(v.z), std::trunc(v.w));
+#endif
 }
 static float4 round(const float4& v) noexcept
 {
 	return float4(std::round(v.x), std::round(v.y), std::round(v.z), std::round(v.w));
 }
-static float4 sign(const float4& v) noexcept { return float4(sign(v.x), sign(v.y), sign(v.z), sign(v.w)); }
+static float4 sign(const float4& v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto d = toSimd(v); auto one = _mm_set1_ps(1.0f);
+	return fromSimd(_mm_sub_ps(_mm_and_ps(_mm_cmpgt_ps(d, _mm_setzero_ps()), one),
+		_mm_and_ps(_mm_cmplt_ps(d, _mm_setzero_ps()), one)));
+#else
+	return float4(sign(v.x), sign(v.y), sign(v.z), sign(v.w));
+#endif
+}
+/**
+ * @brief Extracts sign bits of the vector components. (including -0.0 and NaN signs)
+ * @param[in] v target vector to extract sign bits
+ */
+static int32 signBits(const float4& v) noexcept
+{
+#if MATH_SIMD_SSE2
+	return _mm_movemask_ps(toSimd(v));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	auto bits = vshrq_n_u32(vreinterpretq_u32_f32(toSimd(v)), 31);
+	const uint32x4_t weights = { 1u, 2u, 4u, 8u };
+	return (int32)vaddvq_u32(vmulq_u32(bits, weights));
+#else
+	return (int32)std::signbit(v.x) | ((int32)std::signbit(v.y) << 1) |
+		((int32)std::signbit(v.z) << 2) | ((int32)std::signbit(v.w) << 3);
+#endif
+}
 static float4 exp(const float4& v) noexcept
 {
 	return float4(std::exp(v.x), std::exp(v.y), std::exp(v.z), std::exp(v.w));
@@ -781,9 +1083,95 @@ static float4 pow(const float4& a, const float4& b) noexcept
 {
 	return float4(std::pow(a.x, b.x), std::pow(a.y, b.y), std::pow(a.z, b.z), std::pow(a.w, b.w));
 }
+/**
+ * @brief Raises vector components to the integer power. (Binary exponentiation)
+ * @details Costs log2(n) packed multiplies instead of four std::pow calls.
+ *
+ * @param[in] v target vector to raise
+ * @param n target integer power to raise vector to
+ */
+static float4 pow(const float4& v, int32 n) noexcept
+{
+	auto base = n < 0 ? 1.0f / v : v; auto e = n < 0 ? -n : n;
+	auto result = float4(1.0f);
+	while (e != 0)
+	{
+		if ((e & 1) != 0)
+			result *= base;
+		base *= base; e >>= 1;
+	}
+	return result;
+}
+static float4 fastLog2(const float4& v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto bits = _mm_castps_si128(toSimd(v));
+	auto e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+	auto m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(
+		bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+	auto p = _mm_set1_ps(-0.056570851f);
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(0.44717955f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.4699568f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.8212026f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.7417939f));
+	return fromSimd(_mm_add_ps(_mm_mul_ps(p, _mm_set1_ps(1.4426950f)), e));
+#elif MATH_SIMD_NEON
+	auto bits = vreinterpretq_u32_f32(toSimd(v));
+	auto e = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+	auto m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(
+		bits, vdupq_n_u32(0x007FFFFFu)), vdupq_n_u32(0x3F800000u)));
+	auto p = vdupq_n_f32(-0.056570851f);
+	p = vaddq_f32(vmulq_f32(p, m), vdupq_n_f32(0.44717955f));
+	p = vaddq_f32(vmulq_f32(p, m), vdupq_n_f32(-1.4699568f));
+	p = vaddq_f32(vmulq_f32(p, m), vdupq_n_f32(2.8212026f));
+	p = vaddq_f32(vmulq_f32(p, m), vdupq_n_f32(-1.7417939f));
+	return fromSimd(vaddq_f32(vmulq_f32(p, vdupq_n_f32(1.4426950f)), e));
+#else
+	return float4(fastLog2(v.x), fastLog2(v.y), fastLog2(v.z), fastLog2(v.w));
+#endif
+}
+static float4 fastExp2(const float4& v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto d = _mm_max_ps(toSimd(v), _mm_set1_ps(-127.0f));
+	auto f = _mm_floor_ps(d);
+	auto x = _mm_sub_ps(d, f);
+	auto p = _mm_set1_ps(0.0013333558f);
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0096181291f));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.055504109f));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.24022651f));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.69314718f));
+	p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.0f));
+	auto s = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(
+		_mm_cvtps_epi32(f), _mm_set1_epi32(127)), 23));
+	return fromSimd(_mm_mul_ps(s, p));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	auto d = vmaxq_f32(toSimd(v), vdupq_n_f32(-127.0f));
+	auto f = vrndmq_f32(d);
+	auto x = vsubq_f32(d, f);
+	auto p = vdupq_n_f32(0.0013333558f);
+	p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(0.0096181291f));
+	p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(0.055504109f));
+	p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(0.24022651f));
+	p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(0.69314718f));
+	p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(1.0f));
+	auto s = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(
+		vcvtq_s32_f32(f), vdupq_n_s32(127)), 23));
+	return fromSimd(vmulq_f32(s, p));
+#else
+	return float4(fastExp2(v.x), fastExp2(v.y), fastExp2(v.z), fastExp2(v.w));
+#endif
+}
+static float4 fastPow(const float4& a, const float4& b) noexcept { return fastExp2(b * fastLog2(a)); }
 static float4 sqrt(const float4& v) noexcept
 {
+#if MATH_SIMD_SSE2
+	return fromSimd(_mm_sqrt_ps(toSimd(v)));
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	return fromSimd(vsqrtq_f32(toSimd(v)));
+#else
 	return float4(std::sqrt(v.x), std::sqrt(v.y), std::sqrt(v.z), std::sqrt(v.w));
+#endif
 }
 static float4 cbrt(const float4& v) noexcept
 {
@@ -797,6 +1185,11 @@ static float4 cos(const float4& v) noexcept
 {
 	return float4(std::cos(v.x), std::cos(v.y), std::cos(v.z), std::cos(v.w));
 }
+static void sinCos(const float4& v, float4& s, float4& c) noexcept
+{
+	sinCos(v.x, s.x, c.x); sinCos(v.y, s.y, c.y);
+	sinCos(v.z, s.z, c.z); sinCos(v.w, s.w, c.w);
+}
 static float4 tan(const float4& v) noexcept
 {
 	return float4(std::tan(v.x), std::tan(v.y), std::tan(v.z), std::tan(v.w));
@@ -842,40 +1235,733 @@ static float4 atanh(const float4& v) noexcept
 	return float4(std::atanh(v.x), std::atanh(v.y), std::atanh(v.z), std::atanh(v.w));
 }
 
+static float4 select(const uint4& c, const float4& t, const float4& f) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto mask = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&c), _mm_setzero_si128());
+	return fromSimd(_mm_blendv_ps(toSimd(t), toSimd(f), _mm_castsi128_ps(mask)));
+#elif MATH_SIMD_NEON
+	auto mask = vceqq_u32(vld1q_u32((const uint32*)&c), vdupq_n_u32(0u));
+	return fromSimd(vbslq_f32(mask, toSimd(f), toSimd(t)));
+#else
+	return float4(c.x != 0u ? t.x : f.x, c.y != 0u ? t.y : f.y,
+		c.z != 0u ? t.z : f.z, c.w != 0u ? t.w : f.w);
+#endif
+}
+static uint4 equal(const float4& a, const float4& b) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto mask = _mm_castps_si128(_mm_cmpeq_ps(toSimd(a), toSimd(b)));
+	uint4 result; _mm_storeu_si128((__m128i*)&result, mask);
+	return result;
+#elif MATH_SIMD_NEON
+	auto mask = vceqq_f32(toSimd(a), toSimd(b));
+	uint4 result; vst1q_u32((uint32*)&result, mask);
+	return result;
+#else
+	return uint4(a.x == b.x ? 0xFFFFFFFFu : 0u, a.y == b.y ? 0xFFFFFFFFu : 0u,
+		a.z == b.z ? 0xFFFFFFFFu : 0u, a.w == b.w ? 0xFFFFFFFFu : 0u);
+#endif
+}
+static uint4 notEqual(const float4& a, const float4& b) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto mask = _mm_castps_si128(_mm_cmpneq_ps(toSimd(a), toSimd(b)));
+	uint4 result; _mm_storeu_si128((__m128i*)&result, mask);
+	return result;
+#elif MATH_SIMD_NEON
+	auto mask = vmvnq_u32(vceqq_f32(toSimd(a), toSimd(b)));
+	uint4 result; vst1q_u32((uint32*)&result, mask);
+	return result;
+#else
+	return uint4(a.x != b.x ? 0xFFFFFFFFu : 0u, a.y != b.y ? 0xFFFFFFFFu : 0u,
+		a.z != b.z ? 0xFFFFFFFFu : 0u, a.w != b.w ? 0xFFFFFFFFu : 0u);
+#endif
+}
 static float4 clamp(const float4& v, const float4& min, const float4& max) noexcept
 {
+#if MATH_SIMD_SSE2
+	return fromSimd(_mm_min_ps(_mm_max_ps(toSimd(v), toSimd(min)), toSimd(max)));
+#elif MATH_SIMD_NEON
+	return fromSimd(vminq_f32(vmaxq_f32(toSimd(v), toSimd(min)), toSimd(max)));
+#else
 	return float4(std::clamp(v.x, min.x, max.x), std::clamp(v.y, min.y, max.y),
 		std::clamp(v.z, min.z, max.z), std::clamp(v.w, min.w, max.w));
+#endif
 }
-static float4 repeat(const float4& v) noexcept { return float4(repeat(v.x), repeat(v.y), repeat(v.z), repeat(v.w)); }
+static float4 repeat(const float4& v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto d = toSimd(v);
+	return fromSimd(_mm_sub_ps(d, _mm_floor_ps(d)));
+#else
+	return float4(repeat(v.x), repeat(v.y), repeat(v.z), repeat(v.w));
+#endif
+}
+static constexpr float sum(const float4& v) noexcept { return v.x + v.y + v.z + v.w; }
 static constexpr float dot(const float4& a, const float4& b) noexcept
 {
 	return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 }
+/**
+ * @brief Calculates cross product of the first three vector components. (xyz)
+ * @details Fourth component of the resulting vector is always zero.
+ */
+static float4 cross(const float4& a, const float4& b) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto d = toSimd(a), e = toSimd(b);
+	auto aYzx = _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 0, 2, 1));
+	auto bYzx = _mm_shuffle_ps(e, e, _MM_SHUFFLE(3, 0, 2, 1));
+	auto c = _mm_sub_ps(_mm_mul_ps(d, bYzx), _mm_mul_ps(aYzx, e));
+	c = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	// Masking clears FMA contraction residue out of the fourth lane.
+	return fromSimd(_mm_and_ps(c, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0))));
+#else
+	return float4(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x, 0.0f);
+#endif
+}
 static float length(const float4& v) noexcept { return std::sqrt(dot(v, v)); }
+/**
+ * @brief Calculates length of the vector without overflowing the squared sum. (Overflow safe)
+ * @details Scales by the biggest component magnitude, costs more than @ref length().
+ * @param[in] v target vector to calculate length
+ */
+static float safeLength(const float4& v) noexcept
+{
+	auto a = abs(v);
+	auto m = std::max(std::max(a.x, a.y), std::max(a.z, a.w));
+	if (m == 0.0f)
+		return 0.0f;
+	auto s = v * (1.0f / m);
+	return m * std::sqrt(dot(s, s));
+}
 static constexpr float length2(const float4& v) noexcept { return dot(v, v); }
 static float distance(const float4& a, const float4& b) noexcept { return length(a - b); }
 static constexpr float distance2(const float4& a, const float4& b) noexcept { return length2(a - b); }
+static constexpr bool lengthLessThan(const float4& v, float r) noexcept { return length2(v) < r * r; }
+static constexpr bool distanceLessThan(const float4& a, const float4& b, float r) noexcept
+{
+	return length2(a - b) < r * r;
+}
 static float4 normalize(const float4& v) noexcept
 {
 	auto l = length(v);
 	assert(l > 0.0f);
 	return v * (1.0f / l);
 }
+static float4 fastRsqrt(const float4& v) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto d = toSimd(v);
+	auto r = _mm_rsqrt_ps(d);
+	r = _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(
+		_mm_mul_ps(_mm_mul_ps(d, _mm_set1_ps(0.5f)), r), r)));
+	return fromSimd(r);
+#elif MATH_SIMD_NEON
+	auto d = toSimd(v);
+	auto r = vrsqrteq_f32(d);
+	r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(d, r), r));
+	return fromSimd(r);
+#else
+	return float4(fastRsqrt(v.x), fastRsqrt(v.y), fastRsqrt(v.z), fastRsqrt(v.w));
+#endif
+}
+static float4 fastNormalize(const float4& v) noexcept { return v * fastRsqrt(dot(v, v)); }
 static float4 lerp(const float4& a, const float4& b, float t) noexcept
 {
 	assert(t >= 0.0f);
 	assert(t <= 1.0f);
+#if MATH_SIMD_FMA
+	auto d = toSimd(a);
+	return fromSimd(_mm_fmadd_ps(_mm_set1_ps(t), _mm_sub_ps(toSimd(b), d), d));
+#else
 	return a * (1.0f - t) + b * t;
+#endif
 }
 static float4 lerpDelta(const float4& a, const float4& b, float f, float dt) noexcept
 {
 	return a + (1.0f - std::pow(f, dt)) * (b - a);
 }
+static float4 fastLerpDelta(const float4& a, const float4& b, float f, float dt) noexcept
+{
+	return a + (1.0f - fastPow(f, dt)) * (b - a);
+}
 static float4 gain(const float4& x, const float4& k) noexcept
 {
-	auto a = float4(0.5f) * pow(2.0f * ((x < 0.5f) ? x : 1.0f - x), k);
-	return (x < 0.5f) ? a : 1.0f - a;
+	return float4(gain(x.x, k.x), gain(x.y, k.y), gain(x.z, k.z), gain(x.w, k.w));
+}
+static float4 fastGain(const float4& x, const float4& k) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto d = toSimd(x); auto half = _mm_set1_ps(0.5f); auto one = _mm_set1_ps(1.0f);
+	auto mask = _mm_cmplt_ps(d, half);
+	auto t = _mm_blendv_ps(_mm_sub_ps(one, d), d, mask);
+	auto a = _mm_mul_ps(half, toSimd(fastPow(fromSimd(_mm_add_ps(t, t)), k)));
+	return fromSimd(_mm_blendv_ps(_mm_sub_ps(one, a), a, mask));
+#elif MATH_SIMD_NEON
+	auto d = toSimd(x); auto half = vdupq_n_f32(0.5f); auto one = vdupq_n_f32(1.0f);
+	auto mask = vcltq_f32(d, half);
+	auto t = vbslq_f32(mask, d, vsubq_f32(one, d));
+	auto a = vmulq_f32(half, toSimd(fastPow(fromSimd(vaddq_f32(t, t)), k)));
+	return fromSimd(vbslq_f32(mask, a, vsubq_f32(one, a)));
+#else
+	return float4(fastGain(x.x, k.x), fastGain(x.y, k.y), fastGain(x.z, k.z), fastGain(x.w, k.w));
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Floating point 4 component vector structure in the half precision storage format. (binary16)
+ * @details Halves the memory traffic of the bandwidth bound vector array workloads.
+ */
+struct half4
+{
+	half data[4]; /**< Vector components. (half precision) */
+
+	/**
+	 * @brief Creates a new zero half precision vector structure.
+	 */
+	constexpr half4() = default;
+	/**
+	 * @brief Creates a new half precision vector structure. (Rounds to the nearest even)
+	 * @param[in] v target single precision vector to convert
+	 */
+	explicit half4(const float4& v) noexcept
+	{
+	#if MATH_SIMD_F16C
+		_mm_storel_epi64((__m128i*)data, _mm_cvtps_ph(
+			toSimd(v), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+	#else
+		convertToHalf((const float*)&v, data, 4);
+	#endif
+	}
+
+	/**
+	 * @brief Converts vector back to the single precision format.
+	 */
+	explicit operator float4() const noexcept
+	{
+	#if MATH_SIMD_F16C
+		return fromSimd(_mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)data)));
+	#else
+		float4 v; convertToFloat(data, (float*)&v, 4);
+		return v;
+	#endif
+	}
+
+	constexpr bool operator==(half4 v) const noexcept
+	{
+		return (data[0] == v.data[0]) & (data[1] == v.data[1]) &
+			(data[2] == v.data[2]) & (data[3] == v.data[3]);
+	}
+	constexpr bool operator!=(half4 v) const noexcept { return !(*this == v); }
+};
+
+/**
+ * @brief Converts single precision vector array to the half precision one.
+ *
+ * @param[in] vectors target single precision vector array
+ * @param[out] halfs resulting half precision vector array
+ * @param count total vector count in the arrays
+ */
+static void convertToHalf(const float4* vectors, half4* halfs, psize count) noexcept
+{
+	convertToHalf((const float*)vectors, (half*)halfs, count * 4);
+}
+/**
+ * @brief Converts half precision vector array to the single precision one.
+ *
+ * @param[in] halfs target half precision vector array
+ * @param[out] vectors resulting single precision vector array
+ * @param count total vector count in the arrays
+ */
+static void convertToFloat(const half4* halfs, float4* vectors, psize count) noexcept
+{
+	convertToFloat((const half*)halfs, (float*)vectors, count * 4);
+}
+
+/***********************************************************************************************************************
+ * @brief Adds two vector arrays component wise.
+ * @details Processes four vectors per iteration on the 256bit pipes.
+ *
+ * @param[in] a first vector array to add
+ * @param[in] b second vector array to add
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void add(const float2* a, const float2* b, float2* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b;
+	auto fr = (float*)results;
+	auto total = count * 2;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_add_ps(_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i)));
+	i /= 2;
+#endif
+	for (; i < count; i++)
+		results[i] = a[i] + b[i];
+}
+
+/***********************************************************************************************************************
+ * @brief Adds two vector arrays component wise.
+ * @details Traverses the packed components as one scalar stream, eight per 256bit operation.
+ *
+ * @param[in] a first vector array to add
+ * @param[in] b second vector array to add
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void add(const float3* a, const float3* b, float3* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b;
+	auto fr = (float*)results;
+	auto total = count * 3;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_add_ps(_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i)));
+	for (; i < total; i++)
+		fr[i] = fa[i] + fb[i];
+#else
+	for (; i < count; i++)
+		results[i] = a[i] + b[i];
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Adds two vector arrays component wise.
+ * @details Processes two vectors per iteration on the 256bit pipes.
+ *
+ * @param[in] a first vector array to add
+ * @param[in] b second vector array to add
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void add(const float4* a, const float4* b, float4* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b;
+	auto fr = (float*)results;
+	auto total = count * 4;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_add_ps(_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i)));
+	i /= 4;
+#endif
+	for (; i < count; i++)
+		results[i] = a[i] + b[i];
+}
+/**
+ * @brief Multiplies two vector arrays component wise.
+ * @details See the @ref add(), same all lane traversal.
+ *
+ * @param[in] a first vector array to multiply
+ * @param[in] b second vector array to multiply
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void mul(const float4* a, const float4* b, float4* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b;
+	auto fr = (float*)results;
+	auto total = count * 4;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_mul_ps(_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i)));
+	i /= 4;
+#endif
+	for (; i < count; i++)
+		results[i] = a[i] * b[i];
+}
+/**
+ * @brief Fuse multiplies and adds three vector arrays component wise. (a * b + c)
+ * @details See the @ref add(), same all lane traversal.
+ *
+ * @param[in] a first vector array to multiply
+ * @param[in] b second vector array to multiply
+ * @param[in] c third vector array to add
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void fma(const float4* a, const float4* b, const float4* c, float4* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b, fc = (const float*)c;
+	auto fr = (float*)results;
+	auto total = count * 4;
+	for (; i + 8 <= total; i += 8)
+	{
+		_mm256_storeu_ps(fr + i, _mm256_fmadd_ps(
+			_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i), _mm256_loadu_ps(fc + i)));
+	}
+	i /= 4;
+#endif
+	for (; i < count; i++)
+		results[i] = fma(a[i], b[i], c[i]);
+}
+/**
+ * @brief Calculates minimums of two vector arrays component wise.
+ * @details See the @ref add(), same all lane traversal.
+ *
+ * @param[in] a first vector array to compare
+ * @param[in] b second vector array to compare
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void min(const float4* a, const float4* b, float4* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b;
+	auto fr = (float*)results;
+	auto total = count * 4;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_min_ps(_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i)));
+	i /= 4;
+#endif
+	for (; i < count; i++)
+		results[i] = min(a[i], b[i]);
+}
+/**
+ * @brief Calculates maximums of two vector arrays component wise.
+ * @details See the @ref add(), same all lane traversal.
+ *
+ * @param[in] a first vector array to compare
+ * @param[in] b second vector array to compare
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void max(const float4* a, const float4* b, float4* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fa = (const float*)a, fb = (const float*)b;
+	auto fr = (float*)results;
+	auto total = count * 4;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_max_ps(_mm256_loadu_ps(fa + i), _mm256_loadu_ps(fb + i)));
+	i /= 4;
+#endif
+	for (; i < count; i++)
+		results[i] = max(a[i], b[i]);
+}
+/**
+ * @brief Calculates square roots of the vector array component wise.
+ * @details See the @ref add(), same all lane traversal.
+ *
+ * @param[in] v target vector array to calculate
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void sqrt(const float4* v, float4* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto fv = (const float*)v;
+	auto fr = (float*)results;
+	auto total = count * 4;
+	for (; i + 8 <= total; i += 8)
+		_mm256_storeu_ps(fr + i, _mm256_sqrt_ps(_mm256_loadu_ps(fv + i)));
+	i /= 4;
+#endif
+	for (; i < count; i++)
+		results[i] = sqrt(v[i]);
+}
+
+/***********************************************************************************************************************
+ * @brief Floating point 4 component vector block structure. (AoSoA)
+ * @details
+ * Stores eight vectors as four component planes, so that bulk loops read whole
+ * 256bit registers without any gathering, while keeping per block locality.
+ */
+struct alignas(32) float4x8
+{
+	float x[8]; /**< First components of the block vectors. */
+	float y[8]; /**< Second components of the block vectors. */
+	float z[8]; /**< Third components of the block vectors. */
+	float w[8]; /**< Fourth components of the block vectors. */
+
+	/**
+	 * @brief Returns block vector by index.
+	 * @param i target vector index
+	 */
+	float4 get(psize i) const noexcept
+	{
+		assert(i <= 7);
+		return float4(x[i], y[i], z[i], w[i]);
+	}
+	/**
+	 * @brief Sets block vector by index.
+	 *
+	 * @param i target vector index
+	 * @param v target vector value
+	 */
+	void set(psize i, float4 v) noexcept
+	{
+		assert(i <= 7);
+		x[i] = v.x; y[i] = v.y; z[i] = v.z; w[i] = v.w;
+	}
+};
+
+/**
+ * @brief Converts vector array to the vector block one. (AoS to AoSoA)
+ * @details Trailing vectors of the last partial block are filled with zeros.
+ *
+ * @param[in] vectors target vector array to convert
+ * @param[out] blocks resulting vector block array (count / 8 rounded up)
+ * @param count total vector count in the array
+ */
+static void toSoA(const float4* vectors, float4x8* blocks, psize count) noexcept
+{
+	psize blockCount = count / 8, i = 0;
+#if MATH_SIMD_SSE2
+	for (; i < blockCount; i++)
+	{
+		auto block = blocks + i; auto v = vectors + i * 8;
+		for (psize j = 0; j < 8; j += 4)
+		{
+			auto r0 = toSimd(v[j]), r1 = toSimd(v[j + 1]), r2 = toSimd(v[j + 2]), r3 = toSimd(v[j + 3]);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_store_ps(block->x + j, r0); _mm_store_ps(block->y + j, r1);
+			_mm_store_ps(block->z + j, r2); _mm_store_ps(block->w + j, r3);
+		}
+	}
+#else
+	for (; i < blockCount; i++)
+	{
+		auto block = blocks + i; auto v = vectors + i * 8;
+		for (psize j = 0; j < 8; j++)
+			block->set(j, v[j]);
+	}
+#endif
+	if (count % 8 != 0)
+	{
+		auto block = blocks + blockCount; auto v = vectors + blockCount * 8;
+		for (psize j = 0; j < count % 8; j++)
+			block->set(j, v[j]);
+		for (psize j = count % 8; j < 8; j++)
+			block->set(j, float4::zero);
+	}
+}
+/**
+ * @brief Converts vector block array to the vector one. (AoSoA to AoS)
+ *
+ * @param[in] blocks target vector block array to convert
+ * @param[out] vectors resulting vector array
+ * @param count total vector count in the array
+ */
+static void fromSoA(const float4x8* blocks, float4* vectors, psize count) noexcept
+{
+	psize blockCount = count / 8, i = 0;
+#if MATH_SIMD_SSE2
+	for (; i < blockCount; i++)
+	{
+		auto block = blocks + i; auto v = vectors + i * 8;
+		for (psize j = 0; j < 8; j += 4)
+		{
+			auto r0 = _mm_load_ps(block->x + j), r1 = _mm_load_ps(block->y + j);
+			auto r2 = _mm_load_ps(block->z + j), r3 = _mm_load_ps(block->w + j);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			v[j] = fromSimd(r0); v[j + 1] = fromSimd(r1);
+			v[j + 2] = fromSimd(r2); v[j + 3] = fromSimd(r3);
+		}
+	}
+#else
+	for (; i < blockCount; i++)
+	{
+		auto block = blocks + i; auto v = vectors + i * 8;
+		for (psize j = 0; j < 8; j++)
+			v[j] = block->get(j);
+	}
+#endif
+	for (psize j = 0; j < count % 8; j++)
+		vectors[blockCount * 8 + j] = blocks[blockCount].get(j);
+}
+/**
+ * @brief Applies target function to each component plane of the vector block.
+ * @details
+ * Function is called with a pointer to the eight floats of one plane, 32 byte
+ * aligned, so it can load and store the whole plane as a single 256bit register.
+ *
+ * @param[in,out] block target vector block to transform
+ * @param function target function to apply to the planes
+ */
+template<typename F>
+static void transform(float4x8& block, F function) noexcept
+{
+	function(block.x); function(block.y);
+	function(block.z); function(block.w);
+}
+/**
+ * @brief Calculates dot products of two vector blocks. (AoSoA)
+ * @details Eight dot products per call, one fused multiply add chain per component plane.
+ *
+ * @param[in] a first vector block
+ * @param[in] b second vector block
+ * @param[out] results resulting eight dot product values
+ */
+static void dot(const float4x8& a, const float4x8& b, float* results) noexcept
+{
+#if MATH_SIMD_AVX2 && MATH_SIMD_FMA
+	auto r = _mm256_mul_ps(_mm256_load_ps(a.x), _mm256_load_ps(b.x));
+	r = _mm256_fmadd_ps(_mm256_load_ps(a.y), _mm256_load_ps(b.y), r);
+	r = _mm256_fmadd_ps(_mm256_load_ps(a.z), _mm256_load_ps(b.z), r);
+	r = _mm256_fmadd_ps(_mm256_load_ps(a.w), _mm256_load_ps(b.w), r);
+	_mm256_storeu_ps(results, r);
+#else
+	for (psize i = 0; i < 8; i++)
+		results[i] = dot(a.get(i), b.get(i));
+#endif
+}
+/**
+ * @brief Normalizes eight vectors of the block in place. (Fast approximation)
+ * @details Hardware reciprocal square root estimation with one Newton-Raphson step.
+ * @param[in,out] block target vector block to normalize (non-zero length vectors)
+ */
+static void fastNormalize(float4x8& block) noexcept
+{
+#if MATH_SIMD_AVX2 && MATH_SIMD_FMA
+	auto x = _mm256_load_ps(block.x), y = _mm256_load_ps(block.y);
+	auto z = _mm256_load_ps(block.z), w = _mm256_load_ps(block.w);
+	auto d = _mm256_mul_ps(x, x);
+	d = _mm256_fmadd_ps(y, y, d);
+	d = _mm256_fmadd_ps(z, z, d);
+	d = _mm256_fmadd_ps(w, w, d);
+	auto r = _mm256_rsqrt_ps(d);
+	r = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), r),
+		_mm256_fnmadd_ps(d, _mm256_mul_ps(r, r), _mm256_set1_ps(3.0f)));
+	_mm256_store_ps(block.x, _mm256_mul_ps(x, r));
+	_mm256_store_ps(block.y, _mm256_mul_ps(y, r));
+	_mm256_store_ps(block.z, _mm256_mul_ps(z, r));
+	_mm256_store_ps(block.w, _mm256_mul_ps(w, r));
+#else
+	for (psize i = 0; i < 8; i++)
+		block.set(i, fastNormalize(block.get(i)));
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Converts vector array to the split component streams. (AoS to SoA)
+ * @details Resulting streams are consumable by the SoA batch kernels. (@ref dot(), @ref fastNormalize())
+ *
+ * @param[in] vectors target vector array to convert
+ * @param[out] x resulting X component stream
+ * @param[out] y resulting Y component stream
+ * @param[out] z resulting Z component stream
+ * @param count total vector count in the array
+ */
+static void toSoA(const float3* vectors, float* x, float* y, float* z, psize count) noexcept
+{
+	for (psize i = 0; i < count; i++)
+	{
+		auto v = vectors[i];
+		x[i] = v.x; y[i] = v.y; z[i] = v.z;
+	}
+}
+/**
+ * @brief Converts split component streams to the vector array. (SoA to AoS)
+ *
+ * @param[in] x target X component stream
+ * @param[in] y target Y component stream
+ * @param[in] z target Z component stream
+ * @param[out] vectors resulting vector array
+ * @param count total vector count in the array
+ */
+static void fromSoA(const float* x, const float* y, const float* z, float3* vectors, psize count) noexcept
+{
+	for (psize i = 0; i < count; i++)
+		vectors[i] = float3(x[i], y[i], z[i]);
+}
+
+/***********************************************************************************************************************
+ * @brief Calculates dot products of two vector arrays. (SoA)
+ * @details Consumes split component streams, eight vectors per 256bit operation with full lane utilization.
+ *
+ * @param[in] ax first vector array X component stream
+ * @param[in] ay first vector array Y component stream
+ * @param[in] az first vector array Z component stream
+ * @param[in] bx second vector array X component stream
+ * @param[in] by second vector array Y component stream
+ * @param[in] bz second vector array Z component stream
+ * @param[out] results resulting dot product array
+ * @param count total vector count in the arrays
+ */
+static void dot(const float* ax, const float* ay, const float* az,
+	const float* bx, const float* by, const float* bz, float* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2 && MATH_SIMD_FMA
+	for (; i + 8 <= count; i += 8)
+	{
+		auto d = _mm256_mul_ps(_mm256_loadu_ps(az + i), _mm256_loadu_ps(bz + i));
+		d = _mm256_fmadd_ps(_mm256_loadu_ps(ay + i), _mm256_loadu_ps(by + i), d);
+		d = _mm256_fmadd_ps(_mm256_loadu_ps(ax + i), _mm256_loadu_ps(bx + i), d);
+		_mm256_storeu_ps(results + i, d);
+	}
+#endif
+	for (; i < count; i++)
+		results[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+}
+/**
+ * @brief Normalizes vector array in place. (SoA, fast approximation)
+ * @details Uses the reciprocal square root estimate with one Newton-Raphson step, like @ref fastNormalize().
+ *
+ * @param[in,out] x target vector array X component stream
+ * @param[in,out] y target vector array Y component stream
+ * @param[in,out] z target vector array Z component stream
+ * @param count total vector count in the arrays
+ */
+static void fastNormalize(float* x, float* y, float* z, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2 && MATH_SIMD_FMA
+	for (; i + 8 <= count; i += 8)
+	{
+		auto vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+		auto d = _mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz)));
+		auto r = _mm256_rsqrt_ps(d);
+		r = _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(
+			_mm256_mul_ps(_mm256_mul_ps(d, _mm256_set1_ps(0.5f)), r), r)));
+		_mm256_storeu_ps(x + i, _mm256_mul_ps(vx, r));
+		_mm256_storeu_ps(y + i, _mm256_mul_ps(vy, r));
+		_mm256_storeu_ps(z + i, _mm256_mul_ps(vz, r));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		auto r = fastRsqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+		x[i] *= r; y[i] *= r; z[i] *= r;
+	}
+}
+/**
+ * @brief Linearly interpolates between two value arrays.
+ *
+ * @param[in] a starting value array
+ * @param[in] b ending value array
+ * @param t target interpolation value (from 0.0 to 1.0)
+ * @param[out] results resulting value array (can be the same)
+ * @param count total value count in the arrays
+ */
+static void lerp(const float* a, const float* b, float t, float* results, psize count) noexcept
+{
+	assert(t >= 0.0f);
+	assert(t <= 1.0f);
+	psize i = 0;
+#if MATH_SIMD_AVX2 && MATH_SIMD_FMA
+	auto vt = _mm256_set1_ps(t);
+	for (; i + 8 <= count; i += 8)
+	{
+		auto va = _mm256_loadu_ps(a + i);
+		_mm256_storeu_ps(results + i, _mm256_fmadd_ps(vt,
+			_mm256_sub_ps(_mm256_loadu_ps(b + i), va), va));
+	}
+#endif
+	for (; i < count; i++)
+		results[i] = lerp(a[i], b[i], t);
 }
 
-} // namespace math
\ No newline at end of file
+} // namespace math
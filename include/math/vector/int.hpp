@@ -28,7 +28,7 @@ namespace math
  * @brief Signed integer 2 component vector structure.
  * @details Commonly used to represent: points, positions, directions, velocities, etc.
  */
-struct int2
+struct alignas(8) int2
 {
 	int32 x; /**< First vector component. */
 	int32 y; /**< Second vector component. */
@@ -58,7 +58,7 @@ struct int2
 	int32& operator[](psize i) noexcept
 	{
 		assert(i <= 1);
-		return ((int32*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -67,7 +67,7 @@ struct int2
 	int32 operator[](psize i) const noexcept
 	{
 		assert(i <= 1);
-		return ((int32*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -86,7 +86,7 @@ struct int2
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept { return to_string(x) + " " + to_string(y); }
+	std::string toString() const noexcept { return math::toString((const int32*)this, 2); }
 
 	constexpr int2 operator+(int2 v) const noexcept { return int2(x + v.x, y + v.y); }
 	constexpr int2 operator-(int2 v) const noexcept { return int2(x - v.x, y - v.y); }
@@ -122,12 +122,12 @@ struct int2
 	int2& operator>>=(int32 n) noexcept { x >>= n; y >>= n; return *this; }
 	int2& operator<<=(int32 n) noexcept { x <<= n; y <<= n; return *this; }
 	int2& operator=(int32 n) noexcept { x = n; y = n; return *this; }
-	constexpr bool operator==(int2 v) const noexcept { return x == v.x && y == v.y; }
-	constexpr bool operator!=(int2 v) const noexcept { return x != v.x || y != v.y; }
-	constexpr bool operator<(int2 v) const noexcept { return x < v.x && y < v.y; }
-	constexpr bool operator>(int2 v) const noexcept { return x > v.x && y > v.y; }
-	constexpr bool operator<=(int2 v) const noexcept { return x <= v.x && y <= v.y; }
-	constexpr bool operator>=(int2 v) const noexcept { return x >= v.x && y >= v.y; }
+	constexpr bool operator==(int2 v) const noexcept { return (x == v.x) & (y == v.y); }
+	constexpr bool operator!=(int2 v) const noexcept { return (x != v.x) | (y != v.y); }
+	constexpr bool operator<(int2 v) const noexcept { return (x < v.x) & (y < v.y); }
+	constexpr bool operator>(int2 v) const noexcept { return (x > v.x) & (y > v.y); }
+	constexpr bool operator<=(int2 v) const noexcept { return (x <= v.x) & (y <= v.y); }
+	constexpr bool operator>=(int2 v) const noexcept { return (x >= v.x) & (y >= v.y); }
 
 	static const int2 zero, one, minusOne, left, right, bottom, top;
 };
@@ -190,7 +190,7 @@ struct int3
 	int32& operator[](psize i) noexcept
 	{
 		assert(i <= 2);
-		return ((int32*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -199,7 +199,7 @@ struct int3
 	int32 operator[](psize i) const noexcept
 	{
 		assert(i <= 2);
-		return ((int32*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -226,7 +226,7 @@ struct int3
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept { return to_string(x) + " " + to_string(y) + " " + to_string(z); }
+	std::string toString() const noexcept { return math::toString((const int32*)this, 3); }
 
 	constexpr int3 operator+(const int3& v) const noexcept { return int3(x + v.x, y + v.y, z + v.z); }
 	constexpr int3 operator-(const int3& v) const noexcept { return int3(x - v.x, y - v.y, z - v.z); }
@@ -262,12 +262,12 @@ struct int3
 	int3& operator>>=(int32 n) noexcept { x >>= n; y >>= n; z >>= n; return *this; }
 	int3& operator<<=(int32 n) noexcept { x <<= n; y <<= n; z <<= n; return *this; }
 	int3& operator=(int32 n) noexcept { x = n; y = n; z = n; return *this; }
-	constexpr bool operator==(const int3& v) const noexcept { return x == v.x && y == v.y && z == v.z; }
-	constexpr bool operator!=(const int3& v) const noexcept { return x != v.x || y != v.y || z != v.z; }
-	constexpr bool operator<(const int3& v) const noexcept {return x < v.x && y < v.y && z < v.z; }
-	constexpr bool operator>(const int3& v) const noexcept {return x > v.x && y > v.y && z > v.z; }
-	constexpr bool operator<=(const int3& v) const noexcept { return x <= v.x && y <= v.y && z <= v.z; }
-	constexpr bool operator>=(const int3& v) const noexcept { return x >= v.x && y >= v.y && z >= v.z; }
+	constexpr bool operator==(const int3& v) const noexcept { return (x == v.x) & (y == v.y) & (z == v.z); }
+	constexpr bool operator!=(const int3& v) const noexcept { return (x != v.x) | (y != v.y) | (z != v.z); }
+	constexpr bool operator<(const int3& v) const noexcept {return (x < v.x) & (y < v.y) & (z < v.z); }
+	constexpr bool operator>(const int3& v) const noexcept {return (x > v.x) & (y > v.y) & (z > v.z); }
+	constexpr bool operator<=(const int3& v) const noexcept { return (x <= v.x) & (y <= v.y) & (z <= v.z); }
+	constexpr bool operator>=(const int3& v) const noexcept { return (x >= v.x) & (y >= v.y) & (z >= v.z); }
 
 	static const int3 zero, one, minusOne, left, right, bottom, top, back, front;
 };
@@ -286,7 +286,7 @@ inline const int3 int3::front = int3(0, 0, 1);
  * @brief Signed integer 4 component vector structure.
  * @details Commonly used to represent: points, positions, directions, velocities, etc.
  */
-struct int4
+struct alignas(16) int4
 {
 	int32 x; /**< First vector component. */
 	int32 y; /**< Second vector component. */
@@ -366,7 +366,7 @@ struct int4
 	int32& operator[](psize i) noexcept
 	{
 		assert(i <= 3);
-		return ((int32*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -375,7 +375,7 @@ struct int4
 	int32 operator[](psize i) const noexcept
 	{
 		assert(i <= 3);
-		return ((int32*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -410,10 +410,7 @@ struct int4
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept
-	{
-		return to_string(x) + " " + to_string(y) + " " + to_string(z) + " " + to_string(w);
-	}
+	std::string toString() const noexcept { return math::toString((const int32*)this, 4); }
 
 	constexpr int4 operator+(const int4& v) const noexcept { return int4(x + v.x, y + v.y, z + v.z, w + v.w); }
 	constexpr int4 operator-(const int4& v) const noexcept { return int4(x - v.x, y - v.y, z - v.z, w - v.w); }
@@ -449,12 +446,12 @@ struct int4
 	int4& operator>>=(int32 n) noexcept { x >>= n; y >>= n; z >>= n; w >>= n; return *this; }
 	int4& operator<<=(int32 n) noexcept { x <<= n; y <<= n; z <<= n; w <<= n; return *this; }
 	int4& operator=(int32 n) noexcept { x = n; y = n; z = n; w = n; return *this; }
-	constexpr bool operator==(const int4& v) const noexcept { return x == v.x && y == v.y && z == v.z && w == v.w; }
-	constexpr bool operator!=(const int4& v) const noexcept { return x != v.x || y != v.y || z != v.z || w != v.w; }
-	constexpr bool operator<(const int4& v) const noexcept { return x < v.x && y < v.y && z < v.z && w < v.w; }
-	constexpr bool operator>(const int4& v) const noexcept { return x > v.x && y > v.y && z > v.z && w > v.w; }
-	constexpr bool operator<=(const int4& v) const noexcept { return x <= v.x && y <= v.y && z <= v.z && w <= v.w; }
-	constexpr bool operator>=(const int4& v) const noexcept { return x >= v.x && y >= v.y && z >= v.z && w >= v.w; }
+	constexpr bool operator==(const int4& v) const noexcept { return (x == v.x) & (y == v.y) & (z == v.z) & (w == v.w); }
+	constexpr bool operator!=(const int4& v) const noexcept { return (x != v.x) | (y != v.y) | (z != v.z) | (w != v.w); }
+	constexpr bool operator<(const int4& v) const noexcept { return (x < v.x) & (y < v.y) & (z < v.z) & (w < v.w); }
+	constexpr bool operator>(const int4& v) const noexcept { return (x > v.x) & (y > v.y) & (z > v.z) & (w > v.w); }
+	constexpr bool operator<=(const int4& v) const noexcept { return (x <= v.x) & (y <= v.y) & (z <= v.z) & (w <= v.w); }
+	constexpr bool operator>=(const int4& v) const noexcept { return (x >= v.x) & (y >= v.y) & (z >= v.z) & (w >= v.w); }
 
 	static const int4 zero, one, minusOne;
 };
@@ -504,7 +501,11 @@ static constexpr bool operator>=(int32 n, int2 v) noexcept { return int2(n) >= v
  * @param a first vector to binary compare
  * @param b secong vector to binary compare
  */
-static bool isBinaryLess(int2 a, int2 b) noexcept { return *((const int64*)&a) < *((const int64*)&b); }
+static bool isBinaryLess(int2 a, int2 b) noexcept
+{
+	int64 l, r; std::memcpy(&l, &a, sizeof(int64)); std::memcpy(&r, &b, sizeof(int64));
+	return l < r;
+}
 
 //**********************************************************************************************************************
 static constexpr int3 operator+(const int3& v, int32 n) noexcept { return int3(v.x + n, v.y + n, v.z + n); }
@@ -547,7 +548,13 @@ static constexpr bool operator>=(int32 n, const int3& v) noexcept { return int3(
  * @param[in] a first vector to binary compare
  * @param[in] b secong vector to binary compare
  */
-static bool isBinaryLess(const int3& a, const int3& b) noexcept { return memcmp(&a, &b, sizeof(int32) * 3) < 0; }
+static bool isBinaryLess(const int3& a, const int3& b) noexcept
+{
+	uint64 al, bl; uint32 ah, bh;
+	std::memcpy(&al, &a, sizeof(uint64)); std::memcpy(&ah, (const int32*)&a + 2, sizeof(uint32));
+	std::memcpy(&bl, &b, sizeof(uint64)); std::memcpy(&bh, (const int32*)&b + 2, sizeof(uint32));
+	return al < bl || (al == bl && ah < bh);
+}
 
 //**********************************************************************************************************************
 static constexpr int4 operator+(const int4& v, int32 n) noexcept { return int4(v.x + n, v.y + n, v.z + n, v.w + n); }
@@ -590,7 +597,13 @@ static constexpr bool operator>=(int32 n, const int4& v) noexcept { return int4(
  * @param[in] a first vector to binary compare
  * @param[in] b secong vector to binary compare
  */
-static bool isBinaryLess(const int4& a, const int4& b) noexcept { return memcmp(&a, &b, sizeof(int32) * 4) < 0; }
+static bool isBinaryLess(const int4& a, const int4& b) noexcept
+{
+	uint64 al, ah, bl, bh;
+	std::memcpy(&al, &a, sizeof(uint64)); std::memcpy(&ah, (const int32*)&a + 2, sizeof(uint64));
+	std::memcpy(&bl, &b, sizeof(uint64)); std::memcpy(&bh, (const int32*)&b + 2, sizeof(uint64));
+	return al < bl || (al == bl && ah < bh);
+}
 
 //**********************************************************************************************************************
 static constexpr int2 min(int2 a, int2 b) noexcept { return int2(std::min(a.x, b.x), std::min(a.y, b.y)); }
@@ -626,6 +639,30 @@ static constexpr int32 length2(const int3& v) noexcept { return dot(v, v); }
 static constexpr int32 distance2(const int3& a, const int3& b) noexcept { return length2(a - b); }
 
 //**********************************************************************************************************************
+#if MATH_SIMD_SSE2
+/**
+ * @brief Loads vector into the SIMD register. (Aligned)
+ * @param[in] v target vector to load
+ */
+static __m128i toSimd(const int4& v) noexcept { return _mm_load_si128((const __m128i*)&v); }
+/**
+ * @brief Stores SIMD register to the vector. (Aligned)
+ * @param v target register to store
+ */
+static int4 fromSimd(__m128i v) noexcept { int4 r; _mm_store_si128((__m128i*)&r, v); return r; }
+#elif MATH_SIMD_NEON
+/**
+ * @brief Loads vector into the SIMD register.
+ * @param[in] v target vector to load
+ */
+static int32x4_t toSimd(const int4& v) noexcept { return vld1q_s32((const int32*)&v); }
+/**
+ * @brief Stores SIMD register to the vector.
+ * @param v target register to store
+ */
+static int4 fromSimd(int32x4_t v) noexcept { int4 r; vst1q_s32((int32*)&r, v); return r; }
+#endif
+
 static constexpr int4 min(const int4& a, const int4& b) noexcept
 {
 	return int4(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z), std::min(a.w, b.w));
@@ -648,4 +685,105 @@ static constexpr int32 dot(const int4& a, const int4& b) noexcept
 static constexpr int32 length2(const int4& v) noexcept { return dot(v, v); }
 static constexpr int32 distance2(const int4& a, const int4& b) noexcept { return length2(a - b); }
 
+/***********************************************************************************************************************
+ * @brief Adds two vector arrays component wise.
+ * @details Processes four vectors per iteration on the 256bit pipes.
+ *
+ * @param[in] a first vector array to add
+ * @param[in] b second vector array to add
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void add(const int2* a, const int2* b, int2* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto ia = (const int32*)a, ib = (const int32*)b;
+	auto ir = (int32*)results;
+	auto total = count * 2;
+	for (; i + 8 <= total; i += 8)
+	{
+		_mm256_storeu_si256((__m256i*)(ir + i), _mm256_add_epi32(
+			_mm256_loadu_si256((const __m256i*)(ia + i)), _mm256_loadu_si256((const __m256i*)(ib + i))));
+	}
+	i /= 2;
+#endif
+	for (; i < count; i++)
+		results[i] = a[i] + b[i];
+}
+
+/***********************************************************************************************************************
+ * @brief Adds two vector arrays component wise.
+ * @details Traverses the packed components as one scalar stream, eight per 256bit operation.
+ *
+ * @param[in] a first vector array to add
+ * @param[in] b second vector array to add
+ * @param[out] results resulting vector array (can be the same)
+ * @param count total vector count in the arrays
+ */
+static void add(const int3* a, const int3* b, int3* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	auto ia = (const int32*)a, ib = (const int32*)b;
+	auto ir = (int32*)results;
+	auto total = count * 3;
+	for (; i + 8 <= total; i += 8)
+	{
+		_mm256_storeu_si256((__m256i*)(ir + i), _mm256_add_epi32(
+			_mm256_loadu_si256((const __m256i*)(ia + i)), _mm256_loadu_si256((const __m256i*)(ib + i))));
+	}
+	for (; i < total; i++)
+		ir[i] = ia[i] + ib[i];
+#else
+	for (; i < count; i++)
+		results[i] = a[i] + b[i];
+#endif
+}
+/**
+ * @brief Calculates squared distances between two vector arrays component wise.
+ * @details Squares the difference in one register pass without materializing temporary vectors.
+ *
+ * @param[in] a first vector array
+ * @param[in] b second vector array
+ * @param[out] results resulting squared distance array
+ * @param count total vector count in the arrays
+ */
+static void distance2(const int4* a, const int4* b, int32* results, psize count) noexcept
+{
+	psize i = 0;
+#if MATH_SIMD_AVX2
+	for (; i + 2 <= count; i += 2)
+	{
+		auto d = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(a + i)),
+			_mm256_loadu_si256((const __m256i*)(b + i)));
+		d = _mm256_mullo_epi32(d, d);
+		d = _mm256_hadd_epi32(d, d);
+		d = _mm256_hadd_epi32(d, d);
+		results[i] = _mm256_extract_epi32(d, 0);
+		results[i + 1] = _mm256_extract_epi32(d, 4);
+	}
+#endif
+#if MATH_SIMD_SSE4_1
+	for (; i < count; i++)
+	{
+		auto d = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(a + i)),
+			_mm_loadu_si128((const __m128i*)(b + i)));
+		d = _mm_mullo_epi32(d, d);
+		d = _mm_add_epi32(d, _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)));
+		d = _mm_add_epi32(d, _mm_shuffle_epi32(d, _MM_SHUFFLE(2, 3, 0, 1)));
+		results[i] = _mm_cvtsi128_si32(d);
+	}
+#elif MATH_SIMD_NEON && defined(__aarch64__)
+	for (; i < count; i++)
+	{
+		auto d = vsubq_s32(vld1q_s32((const int32*)(a + i)), vld1q_s32((const int32*)(b + i)));
+		results[i] = vaddvq_s32(vmulq_s32(d, d));
+	}
+#else
+	for (; i < count; i++)
+		results[i] = distance2(a[i], b[i]);
+#endif
+}
+
 } // namespace math
\ No newline at end of file
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "math/types.hpp"
+#include "math/simd.hpp"
 
 #if _WIN32
 #define _USE_MATH_DEFINES
@@ -27,7 +28,9 @@
 #endif
 
 #include <string>
+#include <charconv>
 #include <algorithm>
+#include <type_traits>
 
 #include <cmath>
 #include <cassert>
@@ -36,13 +39,42 @@
 namespace math
 {
 
-using namespace std;
+
+/***********************************************************************************************************************
+ * @brief Converts target value array to the string. (space separated)
+ * @details Formats with to_chars into a stack buffer, avoiding the heap allocations of to_string.
+ *
+ * @param[in] values target value array to convert
+ * @param count total value count in the array
+ */
+template<typename T>
+static std::string toString(const T* values, psize count) noexcept
+{
+#if defined(__cpp_lib_to_chars)
+	char buffer[256]; auto out = buffer;
+	for (psize i = 0; i < count; i++)
+	{
+		if (i > 0)
+			*out++ = ' ';
+		if constexpr (std::is_floating_point_v<T>)
+			out = std::to_chars(out, buffer + sizeof(buffer), values[i], std::chars_format::fixed, 6).ptr;
+		else
+			out = std::to_chars(out, buffer + sizeof(buffer), values[i]).ptr;
+	}
+	return std::string(buffer, out);
+#else
+	auto s = std::to_string(values[0]);
+	for (psize i = 1; i < count; i++)
+		s += " " + std::to_string(values[i]);
+	return s;
+#endif
+}
 
 /***********************************************************************************************************************
  * @brief Unsigned integer 2 component vector structure.
  * @details Commonly used to represent: points, positions, etc.
  */
-struct uint2
+struct alignas(8) uint2
 {
 	uint32 x; /**< First vector component. */
 	uint32 y; /**< Second vector component. */
@@ -67,7 +99,7 @@ struct uint2
 	uint32& operator[](psize i) noexcept
 	{
 		assert(i <= 1);
-		return ((uint32*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -76,7 +108,7 @@ struct uint2
 	uint32 operator[](psize i) const noexcept
 	{
 		assert(i <= 1);
-		return ((uint32*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -87,7 +119,7 @@ struct uint2
 	/*******************************************************************************************************************
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept { return to_string(x) + " " + to_string(y); }
+	std::string toString() const noexcept { return math::toString((const uint32*)this, 2); }
 
 	constexpr uint2 operator+(uint2 v) const noexcept { return uint2(x + v.x, y + v.y); }
 	constexpr uint2 operator-(uint2 v) const noexcept { return uint2(x - v.x, y - v.y); }
@@ -123,12 +155,12 @@ struct uint2
 	uint2& operator>>=(uint32 n) noexcept { x >>= n; y >>= n; return *this; }
 	uint2& operator<<=(uint32 n) noexcept { x <<= n; y <<= n; return *this; }
 	uint2& operator=(uint32 n) noexcept { x = n; y = n; return *this; }
-	constexpr bool operator==(uint2 v) const noexcept { return x == v.x && y == v.y; }
-	constexpr bool operator!=(uint2 v) const noexcept { return x != v.x || y != v.y; }
-	constexpr bool operator<(uint2 v) const noexcept { return x < v.x && y < v.y; }
-	constexpr bool operator>(uint2 v) const noexcept { return x > v.x && y > v.y; }
-	constexpr bool operator<=(uint2 v) const noexcept { return x <= v.x && y <= v.y; }
-	constexpr bool operator>=(uint2 v) const noexcept { return x >= v.x && y >= v.y; }
+	constexpr bool operator==(uint2 v) const noexcept { return (x == v.x) & (y == v.y); }
+	constexpr bool operator!=(uint2 v) const noexcept { return (x != v.x) | (y != v.y); }
+	constexpr bool operator<(uint2 v) const noexcept { return (x < v.x) & (y < v.y); }
+	constexpr bool operator>(uint2 v) const noexcept { return (x > v.x) & (y > v.y); }
+	constexpr bool operator<=(uint2 v) const noexcept { return (x <= v.x) & (y <= v.y); }
+	constexpr bool operator>=(uint2 v) const noexcept { return (x >= v.x) & (y >= v.y); }
 
 	static const uint2 zero, one;
 };
@@ -181,7 +213,7 @@ struct uint3
 	uint32& operator[](psize i) noexcept
 	{
 		assert(i <= 2);
-		return ((uint32*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -190,7 +222,7 @@ struct uint3
 	uint32 operator[](psize i) const noexcept
 	{
 		assert(i <= 2);
-		return ((uint32*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -205,7 +237,7 @@ struct uint3
 	/**
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept { return to_string(x) + " " + to_string(y) + " " + to_string(z); }
+	std::string toString() const noexcept { return math::toString((const uint32*)this, 3); }
 
 	constexpr uint3 operator+(const uint3& v) const noexcept { return uint3(x + v.x, y + v.y, z + v.z); }
 	constexpr uint3 operator-(const uint3& v) const noexcept { return uint3(x - v.x, y - v.y, z - v.z); }
@@ -241,12 +273,12 @@ struct uint3
 	uint3& operator>>=(uint32 n) noexcept { x >>= n; y >>= n; z >>= n; return *this; }
 	uint3& operator<<=(uint32 n) noexcept { x <<= n; y <<= n; z <<= n; return *this; }
 	uint3& operator=(uint32 n) noexcept { x = n; y = n; z = n; return *this; }
-	constexpr bool operator==(const uint3& v) const noexcept { return x == v.x && y == v.y && z == v.z; }
-	constexpr bool operator!=(const uint3& v) const noexcept { return x != v.x || y != v.y || z != v.z; }
-	constexpr bool operator<(const uint3& v) const noexcept {return x < v.x && y < v.y && z < v.z; }
-	constexpr bool operator>(const uint3& v) const noexcept {return x > v.x && y > v.y && z > v.z; }
-	constexpr bool operator<=(const uint3& v) const noexcept { return x <= v.x && y <= v.y && z <= v.z; }
-	constexpr bool operator>=(const uint3& v) const noexcept { return x >= v.x && y >= v.y && z >= v.z; }
+	constexpr bool operator==(const uint3& v) const noexcept { return (x == v.x) & (y == v.y) & (z == v.z); }
+	constexpr bool operator!=(const uint3& v) const noexcept { return (x != v.x) | (y != v.y) | (z != v.z); }
+	constexpr bool operator<(const uint3& v) const noexcept {return (x < v.x) & (y < v.y) & (z < v.z); }
+	constexpr bool operator>(const uint3& v) const noexcept {return (x > v.x) & (y > v.y) & (z > v.z); }
+	constexpr bool operator<=(const uint3& v) const noexcept { return (x <= v.x) & (y <= v.y) & (z <= v.z); }
+	constexpr bool operator>=(const uint3& v) const noexcept { return (x >= v.x) & (y >= v.y) & (z >= v.z); }
 
 	static const uint3 zero, one;
 };
@@ -332,7 +364,7 @@ struct uint4
 	uint32& operator[](psize i) noexcept
 	{
 		assert(i <= 3);
-		return ((uint32*)this)[i];
+		return (&x)[i];
 	}
 	/**
 	 * @brief Returns vector component by index.
@@ -341,7 +373,7 @@ struct uint4
 	uint32 operator[](psize i) const noexcept
 	{
 		assert(i <= 3);
-		return ((uint32*)this)[i];
+		return (&x)[i];
 	}
 
 	/**
@@ -360,10 +392,7 @@ struct uint4
 	/**
 	 * @brief Converts vector to the string. (space separated)
 	 */
-	string toString() const noexcept
-	{
-		return to_string(x) + " " + to_string(y) + " " + to_string(z) + " " + to_string(w);
-	}
+	std::string toString() const noexcept { return math::toString((const uint32*)this, 4); }
 
 	constexpr uint4 operator+(const uint4& v) const noexcept { return uint4(x + v.x, y + v.y, z + v.z, w + v.w); }
 	constexpr uint4 operator-(const uint4& v) const noexcept { return uint4(x - v.x, y - v.y, z - v.z, w - v.w); }
@@ -399,12 +428,12 @@ struct uint4
 	uint4& operator>>=(uint32 n) noexcept { x >>= n; y >>= n; z >>= n; w >>= n; return *this; }
 	uint4& operator<<=(uint32 n) noexcept { x <<= n; y <<= n; z <<= n; w <<= n; return *this; }
 	uint4& operator=(uint32 n) noexcept { x = n; y = n; z = n; w = n; return *this; }
-	constexpr bool operator==(const uint4& v) const noexcept { return x == v.x && y == v.y && z == v.z && w == v.w; }
-	constexpr bool operator!=(const uint4& v) const noexcept { return x != v.x || y != v.y || z != v.z || w != v.w; }
-	constexpr bool operator<(const uint4& v) const noexcept { return x < v.x && y < v.y && z < v.z && w < v.w; }
-	constexpr bool operator>(const uint4& v) const noexcept { return x > v.x && y > v.y && z > v.z && w > v.w; }
-	constexpr bool operator<=(const uint4& v) const noexcept { return x <= v.x && y <= v.y && z <= v.z && w <= v.w; }
-	constexpr bool operator>=(const uint4& v) const noexcept { return x >= v.x && y >= v.y && z >= v.z && w >= v.w; }
+	constexpr bool operator==(const uint4& v) const noexcept { return (x == v.x) & (y == v.y) & (z == v.z) & (w == v.w); }
+	constexpr bool operator!=(const uint4& v) const noexcept { return (x != v.x) | (y != v.y) | (z != v.z) | (w != v.w); }
+	constexpr bool operator<(const uint4& v) const noexcept { return (x < v.x) & (y < v.y) & (z < v.z) & (w < v.w); }
+	constexpr bool operator>(const uint4& v) const noexcept { return (x > v.x) & (y > v.y) & (z > v.z) & (w > v.w); }
+	constexpr bool operator<=(const uint4& v) const noexcept { return (x <= v.x) & (y <= v.y) & (z <= v.z) & (w <= v.w); }
+	constexpr bool operator>=(const uint4& v) const noexcept { return (x >= v.x) & (y >= v.y) & (z >= v.z) & (w >= v.w); }
 
 	static const uint4 zero, one;
 };
@@ -453,7 +482,11 @@ static constexpr bool operator>=(uint32 n, uint2 v) noexcept { return uint2(n) >
  * @param a first vector to binary compare
  * @param b secong vector to binary compare
  */
-static bool isBinaryLess(uint2 a, uint2 b) noexcept { return *((const uint64*)&a) < *((const uint64*)&b); }
+static bool isBinaryLess(uint2 a, uint2 b) noexcept
+{
+	uint64 l, r; std::memcpy(&l, &a, sizeof(uint64)); std::memcpy(&r, &b, sizeof(uint64));
+	return l < r;
+}
 
 //**********************************************************************************************************************
 static constexpr uint3 operator+(const uint3& v, uint32 n) noexcept { return uint3(v.x + n, v.y + n, v.z + n); }
@@ -496,7 +529,13 @@ static constexpr bool operator>=(uint32 n, const uint3& v) noexcept { return uin
  * @param[in] a first vector to binary compare
  * @param[in] b secong vector to binary compare
  */
-static bool isBinaryLess(const uint3& a, const uint3& b) noexcept { return memcmp(&a, &b, sizeof(uint32) * 3) < 0; }
+static bool isBinaryLess(const uint3& a, const uint3& b) noexcept
+{
+	uint64 al, bl; uint32 ah, bh;
+	std::memcpy(&al, &a, sizeof(uint64)); std::memcpy(&ah, (const uint32*)&a + 2, sizeof(uint32));
+	std::memcpy(&bl, &b, sizeof(uint64)); std::memcpy(&bh, (const uint32*)&b + 2, sizeof(uint32));
+	return al < bl || (al == bl && ah < bh);
+}
 
 //**********************************************************************************************************************
 static constexpr uint4 operator+(const uint4& v, uint32 n) noexcept { return uint4(v.x + n, v.y + n, v.z + n, v.w + n); }
@@ -539,7 +578,13 @@ static constexpr bool operator>=(uint32 n, const uint4& v) noexcept { return uin
  * @param[in] a first vector to binary compare
  * @param[in] b secong vector to binary compare
  */
-static bool isBinaryLess(const uint4& a, const uint4& b) noexcept { return memcmp(&a, &b, sizeof(uint32) * 4) < 0; }
+static bool isBinaryLess(const uint4& a, const uint4& b) noexcept
+{
+	uint64 al, ah, bl, bh;
+	std::memcpy(&al, &a, sizeof(uint64)); std::memcpy(&ah, (const uint32*)&a + 2, sizeof(uint64));
+	std::memcpy(&bl, &b, sizeof(uint64)); std::memcpy(&bh, (const uint32*)&b + 2, sizeof(uint64));
+	return al < bl || (al == bl && ah < bh);
+}
 
 //**********************************************************************************************************************
 static constexpr uint2 min(uint2 a, uint2 b) noexcept { return uint2(std::min(a.x, b.x), std::min(a.y, b.y)); }
@@ -553,6 +598,8 @@ static constexpr uint2 clamp(uint2 v, uint2 min, uint2 max) noexcept
 static constexpr uint32 dot(uint2 a, uint2 b) noexcept { return a.x * b.x + a.y * b.y; }
 static constexpr uint32 length2(uint2 v) noexcept { return dot(v, v); }
 static constexpr uint32 distance2(uint2 a, uint2 b) noexcept { return length2(a - b); }
+static constexpr uint2 mulAdd(uint2 a, uint2 b, uint2 c) noexcept { return uint2(a.x * b.x + c.x, a.y * b.y + c.y); }
+static constexpr uint2 mulSub(uint2 a, uint2 b, uint2 c) noexcept { return uint2(a.x * b.x - c.x, a.y * b.y - c.y); }
 
 //**********************************************************************************************************************
 static constexpr uint3 min(const uint3& a, const uint3& b) noexcept
@@ -573,6 +620,14 @@ static constexpr uint3 clamp(const uint3& v, const uint3& min, const uint3& max)
 static constexpr uint32 dot(const uint3& a, const uint3& b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z; }
 static constexpr uint32 length2(const uint3& v) noexcept { return dot(v, v); }
 static constexpr uint32 distance2(const uint3& a, const uint3& b) noexcept { return length2(a - b); }
+static constexpr uint3 mulAdd(const uint3& a, const uint3& b, const uint3& c) noexcept
+{
+	return uint3(a.x * b.x + c.x, a.y * b.y + c.y, a.z * b.z + c.z);
+}
+static constexpr uint3 mulSub(const uint3& a, const uint3& b, const uint3& c) noexcept
+{
+	return uint3(a.x * b.x - c.x, a.y * b.y - c.y, a.z * b.z - c.z);
+}
 
 //**********************************************************************************************************************
 static constexpr uint4 min(const uint4& a, const uint4& b) noexcept
@@ -596,32 +651,199 @@ static constexpr uint32 dot(const uint4& a, const uint4& b) noexcept
 }
 static constexpr uint32 length2(const uint4& v) noexcept { return dot(v, v); }
 static constexpr uint32 distance2(const uint4& a, const uint4& b) noexcept { return length2(a - b); }
+static constexpr uint4 mulAdd(const uint4& a, const uint4& b, const uint4& c) noexcept
+{
+	return uint4(a.x * b.x + c.x, a.y * b.y + c.y, a.z * b.z + c.z, a.w * b.w + c.w);
+}
+static constexpr uint4 mulSub(const uint4& a, const uint4& b, const uint4& c) noexcept
+{
+	return uint4(a.x * b.x - c.x, a.y * b.y - c.y, a.z * b.z - c.z, a.w * b.w - c.w);
+}
+
+/***********************************************************************************************************************
+ * @brief Stores vector to the memory bypassing the CPU cache. (Non-temporal)
+ * @details Use it for big output buffers, which are not going to be read back soon.
+ *
+ * @param[out] values target memory to store vector (16 byte aligned)
+ * @param[in] v vector to store in the memory
+ */
+static void storeStream(uint32* values, const uint4& v) noexcept
+{
+	assert(((psize)values & 15) == 0);
+#if MATH_SIMD_SSE2
+	_mm_stream_si128((__m128i*)values, _mm_loadu_si128((const __m128i*)&v));
+#else
+	std::memcpy(values, &v, sizeof(uint32) * 4);
+#endif
+}
+/**
+ * @brief Loads vector from the memory bypassing the CPU cache. (Non-temporal)
+ * @details Use it for big input buffers, which are read only once.
+ * @param[in] values target memory to load vector from (16 byte aligned)
+ */
+static uint4 loadStream(const uint32* values) noexcept
+{
+	assert(((psize)values & 15) == 0);
+#if MATH_SIMD_SSE4_1
+	auto data = _mm_stream_load_si128((__m128i*)values);
+	uint4 v; std::memcpy(&v, &data, sizeof(uint32) * 4);
+	return v;
+#else
+	return uint4(values[0], values[1], values[2], values[3]);
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Loads four consecutive vectors from the memory deinterleaving components. (AoS to SoA)
+ * @details Use it to get full vector width in the batched reductions and cross lane operations.
+ *
+ * @param[in] values target memory to load vectors from
+ * @param[out] x first components of the loaded vectors
+ * @param[out] y second components of the loaded vectors
+ * @param[out] z third components of the loaded vectors
+ * @param[out] w fourth components of the loaded vectors
+ */
+static void loadDeinterleave4(const uint32* values, uint4& x, uint4& y, uint4& z, uint4& w) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto v0 = _mm_loadu_si128((const __m128i*)values);
+	auto v1 = _mm_loadu_si128((const __m128i*)(values + 4));
+	auto v2 = _mm_loadu_si128((const __m128i*)(values + 8));
+	auto v3 = _mm_loadu_si128((const __m128i*)(values + 12));
+	auto t0 = _mm_unpacklo_epi32(v0, v1), t1 = _mm_unpackhi_epi32(v0, v1);
+	auto t2 = _mm_unpacklo_epi32(v2, v3), t3 = _mm_unpackhi_epi32(v2, v3);
+	_mm_storeu_si128((__m128i*)&x, _mm_unpacklo_epi64(t0, t2));
+	_mm_storeu_si128((__m128i*)&y, _mm_unpackhi_epi64(t0, t2));
+	_mm_storeu_si128((__m128i*)&z, _mm_unpacklo_epi64(t1, t3));
+	_mm_storeu_si128((__m128i*)&w, _mm_unpackhi_epi64(t1, t3));
+#else
+	x = uint4(values[0], values[4], values[8], values[12]);
+	y = uint4(values[1], values[5], values[9], values[13]);
+	z = uint4(values[2], values[6], values[10], values[14]);
+	w = uint4(values[3], values[7], values[11], values[15]);
+#endif
+}
+/**
+ * @brief Stores four vectors to the memory interleaving components. (SoA to AoS)
+ * @details See the @ref loadDeinterleave4().
+ *
+ * @param[out] values target memory to store vectors
+ * @param[in] x first components of the vectors to store
+ * @param[in] y second components of the vectors to store
+ * @param[in] z third components of the vectors to store
+ * @param[in] w fourth components of the vectors to store
+ */
+static void storeInterleave4(uint32* values, const uint4& x, const uint4& y, const uint4& z, const uint4& w) noexcept
+{
+#if MATH_SIMD_SSE2
+	auto vx = _mm_loadu_si128((const __m128i*)&x), vy = _mm_loadu_si128((const __m128i*)&y);
+	auto vz = _mm_loadu_si128((const __m128i*)&z), vw = _mm_loadu_si128((const __m128i*)&w);
+	auto t0 = _mm_unpacklo_epi32(vx, vy), t1 = _mm_unpackhi_epi32(vx, vy);
+	auto t2 = _mm_unpacklo_epi32(vz, vw), t3 = _mm_unpackhi_epi32(vz, vw);
+	_mm_storeu_si128((__m128i*)values, _mm_unpacklo_epi64(t0, t2));
+	_mm_storeu_si128((__m128i*)(values + 4), _mm_unpackhi_epi64(t0, t2));
+	_mm_storeu_si128((__m128i*)(values + 8), _mm_unpacklo_epi64(t1, t3));
+	_mm_storeu_si128((__m128i*)(values + 12), _mm_unpackhi_epi64(t1, t3));
+#else
+	values[0] = x.x; values[4] = x.y; values[8] = x.z; values[12] = x.w;
+	values[1] = y.x; values[5] = y.y; values[9] = y.z; values[13] = y.w;
+	values[2] = z.x; values[6] = z.y; values[10] = z.z; values[14] = z.w;
+	values[3] = w.x; values[7] = w.y; values[11] = w.z; values[15] = w.w;
+#endif
+}
+
+/***********************************************************************************************************************
+ * @brief Returns true if all vector components are zero.
+ * @param v target vector to check
+ */
+static constexpr bool isZero(uint2 v) noexcept { return (v.x | v.y) == 0u; }
+/**
+ * @brief Returns true if all vector components are zero.
+ * @param[in] v target vector to check
+ */
+static constexpr bool isZero(const uint3& v) noexcept { return (v.x | v.y | v.z) == 0u; }
+/**
+ * @brief Returns true if all vector components are zero.
+ * @param[in] v target vector to check
+ */
+static bool isZero(const uint4& v) noexcept
+{
+#if MATH_SIMD_SSE4_1
+	auto data = _mm_loadu_si128((const __m128i*)&v);
+	return _mm_testz_si128(data, data);
+#else
+	return (v.x | v.y | v.z | v.w) == 0u;
+#endif
+}
 
 //**********************************************************************************************************************
-static uint8 calcMipCount(uint32 size) noexcept
+static constexpr uint8 calcMipCount(uint32 size) noexcept
 {
-	return (uint8)(std::floor(std::log2((float)size))) + 1u;
+#if defined(__GNUC__) || defined(__clang__)
+	return (uint8)(32 - __builtin_clz(size | 1u));
+#else
+	uint8 count = 1u;
+	while (size > 1u) { size >>= 1u; count++; }
+	return count;
+#endif
 }
-static uint8 calcMipCount(uint2 size) noexcept
+static constexpr uint8 calcMipCount(uint2 size) noexcept
 {
-	return (uint8)(std::floor(std::log2((float)std::max(size.x, size.y)))) + 1u;
+	return calcMipCount(std::max(size.x, size.y));
 }
-static uint8 calcMipCount(const uint3& size) noexcept
+static constexpr uint8 calcMipCount(const uint3& size) noexcept
 {
-	return (uint8)(std::floor(std::log2((float)std::max(std::max(size.x, size.y), size.z)))) + 1u;
+	return calcMipCount(std::max({ size.x, size.y, size.z }));
 }
 
-static uint32 calcSizeAtMip(uint32 sizeAt0, uint8 mip) noexcept
+static constexpr uint32 calcSizeAtMip(uint32 sizeAt0, uint8 mip) noexcept
+{
+	return std::max(sizeAt0 >> mip, 1u);
+}
+static constexpr uint2 calcSizeAtMip(uint2 sizeAt0, uint8 mip) noexcept
 {
-	return std::max(sizeAt0 / (uint32)std::exp2((float)mip), 1u);
+	return max(uint2(sizeAt0.x >> mip, sizeAt0.y >> mip), uint2(1u));
 }
-static uint2 calcSizeAtMip(uint2 sizeAt0, uint8 mip) noexcept
+static constexpr uint3 calcSizeAtMip(const uint3& sizeAt0, uint8 mip) noexcept
 {
-	return max(sizeAt0 / (uint32)std::exp2((float)mip), uint2(1u));
+	return max(uint3(sizeAt0.x >> mip, sizeAt0.y >> mip, sizeAt0.z >> mip), uint3(1u));
 }
-static uint3 calcSizeAtMip(const uint3& sizeAt0, uint8 mip) noexcept
+
+/**
+ * @brief Calculates the full image mip chain sizes. (From biggest to smallest)
+ *
+ * @param sizeAt0 target image size at mip 0
+ * @param[out] sizes resulting mip size array
+ * @param mipCount total mip count in the chain
+ */
+static void calcMipChain(uint32 sizeAt0, uint32* sizes, uint8 mipCount) noexcept
+{
+	for (uint8 i = 0; i < mipCount; i++)
+		sizes[i] = calcSizeAtMip(sizeAt0, i);
+}
+/**
+ * @brief Calculates the full image mip chain sizes. (From biggest to smallest)
+ *
+ * @param sizeAt0 target image size at mip 0
+ * @param[out] sizes resulting mip size array
+ * @param mipCount total mip count in the chain
+ */
+static void calcMipChain(uint2 sizeAt0, uint2* sizes, uint8 mipCount) noexcept
+{
+	for (uint8 i = 0; i < mipCount; i++)
+		sizes[i] = calcSizeAtMip(sizeAt0, i);
+}
+/**
+ * @brief Calculates the full image mip chain sizes. (From biggest to smallest)
+ *
+ * @param[in] sizeAt0 target image size at mip 0
+ * @param[out] sizes resulting mip size array
+ * @param mipCount total mip count in the chain
+ */
+static void calcMipChain(const uint3& sizeAt0, uint3* sizes, uint8 mipCount) noexcept
 {
-	return max(sizeAt0 / (uint32)std::exp2((float)mip), uint3(1u));
+	for (uint8 i = 0; i < mipCount; i++)
+		sizes[i] = calcSizeAtMip(sizeAt0, i);
 }
 
 } // namespace math
\ No newline at end of file
@@ -27,7 +27,6 @@
 namespace math
 {
 
-using namespace std;
 
 /**
  * @brief Version information container.
@@ -73,7 +72,7 @@ struct Version
 	uint8& operator[](psize i) noexcept
 	{
 		assert(i <= 3);
-		return ((uint8*)this)[i];
+		return (&major)[i];
 	}
 	/**
 	 * @brief Returns version part by the index.
@@ -82,7 +81,7 @@ struct Version
 	uint8 operator[](psize i) const noexcept
 	{
 		assert(i <= 3);
-		return ((uint8*)this)[i];
+		return (&major)[i];
 	}
 
 	constexpr bool operator<(Version v) const noexcept { return (uint32)*this < (uint32)v; }
@@ -95,30 +94,30 @@ struct Version
 	/**
 	 * @brief Creates a new version string. (X.X.X.X)
 	 */
-	string toString4() const noexcept
+	std::string toString4() const noexcept
 	{
-		return to_string(major) + "." + to_string(minor) + "." + to_string(patch) + "." + to_string(build);
+		return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch) + "." + std::to_string(build);
 	}
 	/**
 	 * @brief Creates a new version string. (X.X.X)
 	 */
-	string toString3() const noexcept
+	std::string toString3() const noexcept
 	{
-		return to_string(major) + "." + to_string(minor) + "." + to_string(patch);
+		return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
 	}
 	/**
 	 * @brief Creates a new version string. (X.X)
 	 */
-	string toString2() const noexcept
+	std::string toString2() const noexcept
 	{
-		return to_string(major) + "." + to_string(minor);
+		return std::to_string(major) + "." + std::to_string(minor);
 	}
 	/**
 	 * @brief Creates a new version string. (X)
 	 */
-	string toString1() const noexcept
+	std::string toString1() const noexcept
 	{
-		return to_string(major);
+		return std::to_string(major);
 	}
 };
 
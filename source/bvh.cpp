@@ -24,7 +24,7 @@ using namespace math;
 
 //**********************************************************************************************************************
 static Aabb calculateNodeAabb(const Bvh::Node* node, const uint8* vertices, const uint8* indices,
-	const uint32* primitives, uint32 vertexSize, uint32 indexSize, const function<uint32(const uint8*)>& getIndex)
+	const uint32* primitives, uint32 vertexSize, uint32 indexSize, const std::function<uint32(const uint8*)>& getIndex)
 {
 	auto lastPrimitive = node->leaf.firstPrimitive + node->base.primitiveCount;
 	float3 min = float3(FLT_MAX), max = float3(-FLT_MAX);
@@ -62,7 +62,7 @@ static Aabb calculateNodeAabb(const Bvh::Node* node, const Aabb* aabbs, const ui
 
 static void findBestSplitPlane(uint32 firstPrimitive, uint32 lastPrimitive, uint32 vertexSize, uint32 indexSize,
 	const uint8* vertices, const uint8* indices, const uint32* primitives, const float3* centroids,
-	const function<uint32(const uint8*)>& getIndex, int32& axis, float& split, float& cost)
+	const std::function<uint32(const uint8*)>& getIndex, int32& axis, float& split, float& cost)
 {
 	auto bestAxis = 0;
 	auto bestSplit = 0.0f, bestCost = FLT_MAX;
@@ -254,8 +254,8 @@ void Bvh::recreate(const uint8* vertices, const uint8* indices, const Aabb& aabb
 	for (uint32 i = 0; i < primitiveCount; i++)
 		primitives[i] = i;
 
-	function getIndex16 = [](const uint8* data) { return (uint32)*(const uint16*)data; };
-	function getIndex32 = [](const uint8* data) { return *(const uint32*)data; };
+	std::function getIndex16 = [](const uint8* data) { return (uint32)*(const uint16*)data; };
+	std::function getIndex32 = [](const uint8* data) { return *(const uint32*)data; };
 
 	auto getIndex = getIndex32;
 	if (indexSize == sizeof(uint16))
@@ -24,7 +24,7 @@ int main()
 	auto c = b * a;
 	
 	if (c != float4x4(2.0f))
-		throw runtime_error("Bad test matrix value.");
+		throw std::runtime_error("Bad test matrix value.");
 	
 	return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -24,13 +24,19 @@ int main()
 	auto c = a + b;
 
 	if (c.x != 1.4f || c.y != 2.5f || c.z != 3.6f || c != float3(1.4f, 2.5f, 3.6f))
-		throw runtime_error("Bad vector test value.");
+		throw std::runtime_error("Bad vector test value.");
 
 	auto d = int3(10);
 	auto e = d / 2;
 
 	if (e != int3(5))
-		throw runtime_error("Bad vector test value.");
+		throw std::runtime_error("Bad vector test value.");
+
+	if (calcMipCount(16384u) != 15 || calcMipCount(16777216u) != 25 || calcMipCount(33554432u) != 26 ||
+		calcSizeAtMip(16384u, (uint8)14) != 1u || calcSizeAtMip(16384u, (uint8)15) != 1u)
+	{
+		throw std::runtime_error("Bad mip count test value.");
+	}
 
 	return EXIT_SUCCESS;
 }
\ No newline at end of file